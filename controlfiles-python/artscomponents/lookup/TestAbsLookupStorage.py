@@ -0,0 +1,60 @@
+# -*- coding: utf-8 -*-
+"""
+Tests that a lookup table in reduced precision is replaced by a new
+calculation, and that the reduced precision stays close to the original.
+"""
+
+import numpy as np
+import pyarts
+
+ws = pyarts.workspace.Workspace()
+
+ws.water_p_eq_agendaSet()
+ws.gas_scattering_agendaSet()
+ws.PlanetSet(option="Earth")
+
+ws.stokes_dim = 1
+ws.abs_speciesSet(species=["H2O-PWR98", "O2-PWR98"])
+ws.abs_lines_per_speciesSetEmpty()
+ws.Touch(ws.predefined_model_data)
+ws.Touch(ws.select_abs_species)
+ws.jacobianOff()
+
+ws.propmat_clearsky_agendaAuto()
+ws.lbl_checkedCalc()
+
+ws.f_grid = np.linspace(50e9, 150e9, 11)
+
+# The table
+ws.abs_p = np.logspace(5, 3, 8)
+ws.abs_t = np.linspace(290.0, 220.0, 8)
+ws.abs_vmrs = np.array([np.logspace(-2, -5, 8), np.full(8, 0.21)])
+ws.VectorSet(ws.abs_t_pert, [])
+ws.VectorSet(ws.abs_nls_pert, [])
+ws.abs_speciesSet(abs_species=ws.abs_nls, species=[])
+
+# The extraction
+ws.rtp_pressure = 3e4
+ws.rtp_temperature = 250.0
+ws.rtp_vmr = np.array([5e-3, 0.21])
+ws.propmat_clearsky_agenda_checked = 1
+
+
+def extract():
+    ws.propmat_clearskyInit()
+    ws.propmat_clearskyAddFromLookup()
+    return 1.0 * np.array(ws.propmat_clearsky.value.data).flatten()
+
+
+ws.abs_lookupCalc()
+ref = extract()
+assert (ref > 0).all()
+
+for storage in ["Float", "Log16"]:
+    ws.abs_lookupSetStorage(storage=storage)
+    compact = extract()
+    assert np.isclose(compact, ref, rtol=1e-3, atol=0).all(), storage
+
+    # A new calculation must not extract from the old reduced precision data
+    ws.abs_lookupCalc()
+    assert (extract() == ref).all(), storage
@@ -0,0 +1,89 @@
+# -*- coding: utf-8 -*-
+"""
+Tests that iyEmissionStandardPpvarPropmatAgenda gives the same radiances as
+iyEmissionStandard, both with absorption directly from the per point
+propmat_clearsky_agenda and from the lookup table.  The viewing angles cover
+a nadir, a slant and a limb path, and the surface is partly reflecting.
+"""
+
+import numpy as np
+import pyarts
+
+ws = pyarts.workspace.Workspace()
+
+ws.water_p_eq_agendaSet()
+ws.gas_scattering_agendaSet()
+ws.PlanetSet(option="Earth")
+
+ws.iy_space_agendaSet(option="CosmicBackground")
+ws.iy_surface_agendaSet(option="UseSurfaceRtprop")
+ws.surface_rtprop_agendaSet(option="Specular_NoPol_ReflFix_SurfTFromt_field")
+ws.ppath_agendaSet(option="FollowSensorLosPath")
+ws.ppath_step_agendaSet(option="GeometricPath")
+
+ws.stokes_dim = 1
+ws.iy_unit = "PlanckBT"
+ws.Touch(ws.iy_aux_vars)
+ws.Touch(ws.surface_props_data)
+ws.surface_scalar_reflectivity = [0.2]
+
+ws.f_grid = np.linspace(50e9, 150e9, 21)
+
+# Atmosphere
+ws.abs_speciesSet(species=["H2O-PWR98", "O2-PWR98"])
+ws.VectorNLogSpace(ws.p_grid, 41, 1013e2, 10)
+ws.AtmosphereSet1D()
+ws.AtmRawRead(basename="testdata/tropical")
+ws.AtmFieldsCalc()
+ws.MatrixSetConstant(ws.z_surface, 1, 1, 0.0)
+ws.nlteOff()
+ws.jacobianOff()
+ws.cloudboxOff()
+
+# Nadir, slant and limb views from 600 km
+ws.sensor_pos = [[600e3], [600e3], [600e3]]
+ws.sensor_los = [[180.0], [130.0], [113.0]]
+ws.sensorOff()
+
+# Absorption
+ws.abs_lines_per_speciesSetEmpty()
+ws.Touch(ws.predefined_model_data)
+ws.propmat_clearsky_agendaAuto()
+ws.lbl_checkedCalc()
+
+ws.atmfields_checkedCalc()
+ws.atmgeom_checkedCalc()
+ws.cloudbox_checkedCalc()
+ws.sensor_checkedCalc()
+
+
+@pyarts.workspace.arts_agenda(ws=ws, set_agenda=True)
+def iy_main_agenda(ws):
+    ws.ppathCalc()
+    ws.iyEmissionStandardPpvarPropmatAgenda()
+    ws.VectorSet(ws.geo_pos, [])
+
+
+def y_calc(ppvar_propmat_agenda):
+    if ppvar_propmat_agenda is None:
+        ws.iy_main_agendaSet(option="Emission")
+    else:
+        ws.ppvar_propmat_agendaSet(option=ppvar_propmat_agenda)
+        ws.iy_main_agenda = iy_main_agenda
+    ws.yCalc()
+    return 1.0 * np.array(ws.y.value)
+
+
+ref = y_calc(None)
+assert (ref > 0).all()
+assert np.allclose(y_calc("FromPropmatClearskyAgenda"), ref, rtol=1e-12, atol=0)
+
+# The same comparison with absorption from the lookup table
+ws.abs_lookupSetup()
+ws.abs_lookupCalc()
+ws.abs_lookupAdapt()
+ws.propmat_clearsky_agendaAuto(use_abs_lookup=1)
+
+ref = y_calc(None)
+assert (ref > 0).all()
+assert np.allclose(y_calc("FromLookup"), ref, rtol=1e-10, atol=0)
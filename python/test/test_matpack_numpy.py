@@ -0,0 +1,106 @@
+"""
+Test the construction of matpack types from NumPy arrays.
+"""
+import numpy as np
+import pytest
+import pyarts.arts as cxx
+
+
+REAL_TYPES = [cxx.Vector, cxx.Matrix, cxx.Tensor3, cxx.Tensor4,
+              cxx.Tensor5, cxx.Tensor6, cxx.Tensor7]
+
+
+def numbers(shape, dtype=np.float64):
+    """ Distinct values, so that misplaced elements are noticed """
+    return np.arange(np.prod(shape)).astype(dtype).reshape(shape)
+
+
+class TestMatpackNumpy:
+    @pytest.mark.parametrize("rank", range(1, 8))
+    def test_shape(self, rank):
+        t = REAL_TYPES[rank - 1]
+        arr = numbers(tuple(range(2, 2 + rank)))
+
+        x = t(arr)
+        assert np.array(x).shape == arr.shape
+        assert np.array_equal(np.array(x), arr)
+
+        # The data is copied
+        arr[(0,) * rank] = -1
+        assert np.array(x)[(0,) * rank] == 0
+
+    @pytest.mark.parametrize("rank", range(1, 8))
+    def test_wrong_rank(self, rank):
+        t = REAL_TYPES[rank - 1]
+
+        for other in (rank - 1, rank + 1):
+            with pytest.raises(Exception, match="dimensions"):
+                t(np.zeros((2,) * other))
+
+    def test_empty(self):
+        x = cxx.Matrix(np.zeros((0, 3)))
+        assert np.array(x).shape == (0, 3)
+
+    def test_strides(self):
+        arr = numbers((4, 6))
+
+        for view in (arr.T, arr[::2], arr[:, ::-1], arr[1:3, 2:5],
+                     np.asfortranarray(arr)):
+            assert not view.flags.c_contiguous
+            assert np.array_equal(np.array(cxx.Matrix(view)), view)
+
+        arr = numbers((3, 4, 5))
+        view = arr.transpose(2, 0, 1)[::2, :, 1:]
+        assert np.array_equal(np.array(cxx.Tensor3(view)), view)
+
+        vec = numbers(10)
+        assert np.array_equal(np.array(cxx.Vector(vec[::-3])), vec[::-3])
+
+    @pytest.mark.parametrize("dtype", [np.int8, np.int32, np.int64,
+                                       np.uint16, np.float32, np.bool_])
+    def test_dtype(self, dtype):
+        arr = numbers((3, 4), dtype=dtype)
+
+        x = cxx.Matrix(arr)
+        assert np.array(x).dtype == np.float64
+        assert np.array_equal(np.array(x), arr.astype(np.float64))
+
+    def test_complex_dtype(self):
+        arr = numbers(5) + 1j * numbers(5)
+
+        x = cxx.ComplexVector(arr)
+        assert np.array_equal(np.array(x), arr)
+
+        x = cxx.ComplexVector(numbers(5))
+        assert np.array_equal(np.array(x), numbers(5))
+
+        # The imaginary part must not be lost silently
+        with pytest.raises(Exception, match="complex"):
+            cxx.Vector(arr)
+
+    @pytest.mark.parametrize("arr", [np.array(["a", "b"]),
+                                     np.array([None, 1.0], dtype=object),
+                                     np.array(["2000-01-01"],
+                                              dtype="datetime64[D]")])
+    def test_other_dtype(self, arr):
+        with pytest.raises(Exception):
+            cxx.Vector(arr)
+
+    def test_lists(self):
+        """ Lists are not arrays and use their own constructors """
+        x = cxx.Matrix([[1, 2], [3, 4]])
+        assert np.array_equal(np.array(x), [[1, 2], [3, 4]])
+
+        with pytest.raises(Exception):
+            cxx.Matrix([[1, 2], [3]])
+
+
+if __name__ == "__main__":
+    t = TestMatpackNumpy()
+    for rank in range(1, 8):
+        t.test_shape(rank)
+        t.test_wrong_rank(rank)
+    t.test_empty()
+    t.test_strides()
+    t.test_complex_dtype()
+    t.test_lists()
@@ -2,6 +2,7 @@
 Test handling of agendas of the Python interface.
 """
 import os
+import concurrent.futures
 import numpy as np
 import pytest
 import scipy as sp
@@ -335,6 +336,46 @@ exist in the future
             assert opt in ws.PlanetSet.__doc__, f"The {opt}-option is not documented correctly"
             ws.PlanetSet(option=opt)
 
+    def test_concurrent_workspaces(self):
+        """
+        Tests that two workspaces can execute agendas in two Python threads
+        at the same time, as the methods release the GIL.
+        """
+        def clearsky_y():
+            ws = Workspace()
+            ws.execute_controlfile("artscomponents/clearsky/TestClearSky.arts")
+            ws.yCalc()
+            return np.array(ws.y.value)
+
+        y_serial = clearsky_y()
+
+        with concurrent.futures.ThreadPoolExecutor(max_workers=2) as pool:
+            futures = [pool.submit(clearsky_y) for _ in range(2)]
+            for future in futures:
+                assert np.array_equal(future.result(timeout=600), y_serial)
+
+    def test_concurrent_callbacks(self):
+        """
+        Tests that Python callbacks in agendas of two workspaces executed
+        in two Python threads reacquire the GIL without deadlocking.
+        """
+        def count_in_callback(n):
+            ws = Workspace()
+            ws.stokes_dim = 0
+
+            @arts_agenda(ws=ws, allow_callbacks=True, set_agenda=True)
+            def test_agenda(ws):
+                ws.stokes_dim = ws.stokes_dim.value + 1
+
+            for _ in range(n):
+                ws.AgendaExecute(ws.test_agenda)
+            return ws.stokes_dim.value
+
+        with concurrent.futures.ThreadPoolExecutor(max_workers=2) as pool:
+            futures = [pool.submit(count_in_callback, 100) for _ in range(2)]
+            for future in futures:
+                assert future.result(timeout=60) == 100
+
 
 if __name__ == "__main__":
     ta = TestAgendas()
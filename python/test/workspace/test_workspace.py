@@ -20,6 +20,21 @@ class TestWorkspace:
         
         assert ws2.aaavar.value == ws.aaavar.value
     
+    def test_copy_new_variable(self):
+        ws = Workspace()
+        ws2 = copy.copy(ws)
+        ws2.bbbvar = Index(3)
+        ws.cccvar = Index(4)
+
+        assert ws2.bbbvar.value == 3
+        assert not ws.bbbvar.init
+        assert not ws2.cccvar.init
+
+        ws.bbbvar = Index(5)
+        assert ws.bbbvar.value == 5
+        assert ws2.bbbvar.value == 3
+        assert ws.cccvar.value == 4
+
     def test_deepcopy(self):
         ws = Workspace()
         ws.aaavar = Index(5)
@@ -47,6 +62,7 @@ if __name__ == "__main__":
     ta = TestWorkspace()
     ta.setup_method()
     ta.test_copy()
+    ta.test_copy_new_variable()
     ta.test_deepcopy()
     ta.test_copy_agenda()
     
@@ -21,9 +21,14 @@
 #include "species_tags.h"
 #include "zeemandata.h"
 
+#include <memory>
+#include <mutex>
 #include <utility>
 #include <vector>
 
+namespace LineShape {
+struct ParameterCache;
+}  // namespace LineShape
 
 /** Namespace to contain things required for absorption calculations */
 namespace Absorption {
@@ -267,6 +272,27 @@ struct SingleLineExternal {
   SingleLine line;
 };
 
+/** Holder of the optional LineShape::ParameterCache of a band
+ *
+ * The cache is created on first use, also for a const band.  Copies of a
+ * band start without a cache.
+ */
+class ParameterCacheHolder {
+  mutable std::once_flag init{};
+  mutable std::shared_ptr<LineShape::ParameterCache> cache{};
+
+ public:
+  ParameterCacheHolder() = default;
+  ParameterCacheHolder(const ParameterCacheHolder &) noexcept {}
+  ParameterCacheHolder &operator=(const ParameterCacheHolder &) noexcept {
+    return *this;
+  }
+  ~ParameterCacheHolder() = default;
+
+  /** The cache, created if it does not yet exist */
+  [[nodiscard]] LineShape::ParameterCache &data() const;
+};
+
 struct Lines {
   static constexpr Index version = 2;
 
@@ -308,6 +334,9 @@ struct Lines {
   
   /** A list of individual lines */
   Array<SingleLine> lines;
+
+  /** Line parameters of recent atmospheric states, not part of the data */
+  ParameterCacheHolder parameter_cache{};
   
   /** Default initialization
    * 
@@ -80,6 +80,7 @@ void Agenda::append(const String& methodname, const TokVal& keywordvalue) {
 
   mml.push_back(MRecord(id, output, input, keywordvalue, Agenda(*workspace())));
   mchecked = false;
+  mcompiled = false;
 }
 
 //! Checks consistency of an agenda.
@@ -91,6 +92,7 @@ void Agenda::check(Workspace& ws_in, const Verbosity& verbosity) {
   // Check that this agenda has a default workspace
   if (not workspace().get()) {
     mchecked = false;
+    mcompiled = false;
     return;
   }
 
@@ -114,6 +116,7 @@ void Agenda::check(Workspace& ws_in, const Verbosity& verbosity) {
   // until it is copied to a predefined agenda.
   if (mi == AgendaMap.end()) {
     mchecked = false;
+    mcompiled = false;
     return;
   }
 
@@ -157,9 +160,60 @@ void Agenda::check(Workspace& ws_in, const Verbosity& verbosity) {
 
   set_outputs_to_push_and_dup(verbosity);
 
+  compile(ws_in);
+
   mchecked = true;
 }
 
+//! Prepares the data needed to execute a checked agenda.
+/*!
+  Resolves the verbosity WSV index and, for each method, the input WSVs
+  that have to be checked for initialization at run-time. Agenda input is
+  always set by the calling *Execute function and output of an earlier
+  method in the agenda is set by that method, so these are left out.
+  Both are otherwise looked up on every call of execute().
+*/
+void Agenda::compile(Workspace& ws_in) {
+  using global_data::agenda_data;
+  using global_data::AgendaMap;
+  using global_data::md_data;
+
+  const AgRecord& this_data = agenda_data[AgendaMap.at(mname)];
+
+  mverbosity_id = ws_in.WsvMap_ptr->at("verbosity");
+  mverbosity_out = false;
+
+  std::set<Index> known(this_data.In().begin(), this_data.In().end());
+
+  mcheck_in.resize(mml.nelem());
+  for (Index i = 0; i < mml.nelem(); ++i) {
+    const MRecord& mrr = mml[i];
+    const MdRecord& mdd = md_data[mrr.Id()];
+
+    ArrayOfIndex& v = mcheck_in[i];
+    v.resize(0);
+
+    const ArrayOfIndex& in = mrr.In();
+    for (Index s = 0; s < in.nelem(); ++s)
+      if ((s != in.nelem() - 1 || !mdd.SetMethod()) && !known.contains(in[s]))
+        v.push_back(in[s]);
+
+    for (const Index s : mdd.InOut())
+      if (!known.contains(mrr.Out()[s])) v.push_back(mrr.Out()[s]);
+
+    // Delete leaves its input uninitialized for later methods
+    if (mdd.Name() == "Delete")
+      for (const Index s : in) known.erase(s);
+
+    for (const Index s : mrr.Out()) {
+      known.insert(s);
+      if (s == mverbosity_id) mverbosity_out = true;
+    }
+  }
+
+  mcompiled = true;
+}
+
 //! Execute an agenda.
 /*! 
   This executes the methods specified in tasklist on the given
@@ -195,13 +249,22 @@ There are three possible causes for this:
   // The array holding the pointers to the getaway functions:
   extern void (*getaways[])(Workspace&, const MRecord&);
 
-  const Index wsv_id_verbosity = ws_in.WsvMap_ptr->at("verbosity");
-  ws_in.duplicate(wsv_id_verbosity);
+  const Index wsv_id_verbosity =
+      mcompiled ? mverbosity_id : ws_in.WsvMap_ptr->at("verbosity");
+
+  // The verbosity only needs a private copy if this agenda changes it
+  const bool dup_verbosity =
+      not mcompiled or mverbosity_out or
+      static_cast<Verbosity*>(ws_in[wsv_id_verbosity].get())
+              ->is_main_agenda() != is_main_agenda();
+  if (dup_verbosity) ws_in.duplicate(wsv_id_verbosity);
 
   Verbosity& averbosity =
       *(static_cast<Verbosity*>(ws_in[wsv_id_verbosity].get()));
 
-  averbosity.set_main_agenda(is_main_agenda());
+  // Otherwise the verbosity may be shared with parallel workspaces and
+  // must not be written to
+  if (dup_verbosity) averbosity.set_main_agenda(is_main_agenda());
 
   ArtsOut1 aout1(averbosity);
   {
@@ -209,7 +272,7 @@ There are three possible causes for this:
     //    os << "Executing " << name() << "\n"
     //       << "{\n";
     //    aout1 << os.str();
-    aout1 << "Executing " << name() << "\n"
+    aout1 << "Executing " << mname << "\n"
           << "{\n";
   }
 
@@ -225,33 +288,41 @@ There are three possible causes for this:
     const MdRecord& mdd = md_data[mrr.Id()];
 
     try {
-      {
+      {  // Avoid building the message if it is not printed
         if (mrr.isInternal()) {
-          out3 << "- " + mdd.Name() + "\n";
+          if (out3.sufficient_priority()) out3 << "- " + mdd.Name() + "\n";
         } else {
-          out1 << "- " + mdd.Name() + "\n";
+          if (out1.sufficient_priority()) out1 << "- " + mdd.Name() + "\n";
         }
       }
 
-      {  // Check if all input variables are initialized:
-        const ArrayOfIndex& v(mrr.In());
-        for (Index s = 0; s < v.nelem(); ++s) {
-          if ((s != v.nelem() - 1 || !mdd.SetMethod()) &&
-              !ws_in.is_initialized(v[s]))
+      if (mcompiled) {  // Only check what check() could not rule out
+        for (const Index s : mcheck_in[i])
+          if (!ws_in.is_initialized(s))
             throw runtime_error(
                 "Method " + mdd.Name() +
-                " needs input variable: " + (*ws_in.wsv_data_ptr)[v[s]].Name());
+                " needs input variable: " + (*ws_in.wsv_data_ptr)[s].Name());
+      } else {
+        {  // Check if all input variables are initialized:
+          const ArrayOfIndex& v(mrr.In());
+          for (Index s = 0; s < v.nelem(); ++s) {
+            if ((s != v.nelem() - 1 || !mdd.SetMethod()) &&
+                !ws_in.is_initialized(v[s]))
+              throw runtime_error(
+                  "Method " + mdd.Name() +
+                  " needs input variable: " + (*ws_in.wsv_data_ptr)[v[s]].Name());
+          }
         }
-      }
 
-      {  // Check if all output variables which are also used as input
-        // are initialized
-        const ArrayOfIndex& v = mdd.InOut();
-        for (Index s = 0; s < v.nelem(); ++s)
-          if (!ws_in.is_initialized(mrr.Out()[v[s]]))
-            throw runtime_error("Method " + mdd.Name() +
-                                " needs input variable: " +
-                                (*ws_in.wsv_data_ptr)[mrr.Out()[v[s]]].Name());
+        {  // Check if all output variables which are also used as input
+          // are initialized
+          const ArrayOfIndex& v = mdd.InOut();
+          for (Index s = 0; s < v.nelem(); ++s)
+            if (!ws_in.is_initialized(mrr.Out()[v[s]]))
+              throw runtime_error("Method " + mdd.Name() +
+                                  " needs input variable: " +
+                                  (*ws_in.wsv_data_ptr)[mrr.Out()[v[s]]].Name());
+        }
       }
 
       // Call the getaway function:
@@ -279,7 +350,7 @@ There are three possible causes for this:
 
   aout1 << "}\n";
 
-  ws_in.pop(wsv_id_verbosity);
+  if (dup_verbosity) ws_in.pop(wsv_id_verbosity);
 }
 
 //! Retrieve indexes of all input and output WSVs
@@ -665,6 +736,7 @@ bool Agenda::is_output(Index var) const {
 void Agenda::set_name(const String& nname) {
   mname = nname;
   mchecked = false;
+  mcompiled = false;
 }
 
 //! Agenda name.
@@ -703,6 +775,7 @@ bool Agenda::has_method(const String& methodname) const {
 void Agenda::set_methods(const Array<MRecord>& ml) {
   mml = ml;
   mchecked = false;
+  mcompiled = false;
 }
 
 //! Print an agenda.
@@ -727,7 +800,10 @@ void Agenda::print(ostream& os, const String& indent) const {
 /*!
   Resizes the agenda's method list to n elements
  */
-void Agenda::resize(Index n) { mml.resize(n); }
+void Agenda::resize(Index n) {
+  mml.resize(n);
+  mcompiled = false;
+}
 
 //! Return the number of agenda elements.
 /*!  
@@ -747,6 +823,7 @@ Index Agenda::nelem() const { return mml.nelem(); }
 void Agenda::push_back(const MRecord& n) {
   mml.push_back(n);
   mchecked = false;
+  mcompiled = false;
 }
 
 Agenda& Agenda::operator=(const Agenda& x) {
@@ -756,6 +833,10 @@ Agenda& Agenda::operator=(const Agenda& x) {
   moutput_push = x.moutput_push;
   moutput_dup = x.moutput_dup;
   mchecked = x.mchecked;
+  mcompiled = x.mcompiled;
+  mverbosity_id = x.mverbosity_id;
+  mverbosity_out = x.mverbosity_out;
+  mcheck_in = x.mcheck_in;
   return *this;
 }
 
@@ -940,6 +1021,7 @@ Agenda Agenda::deepcopy_if(Workspace& workspace) const {
   out.moutput_dup = make_same_wsvs(workspace, *this->workspace(), moutput_dup);
   out.main_agenda = main_agenda;
   out.mchecked = mchecked;
+  if (mcompiled) out.compile(workspace);
 
   return out;
 }
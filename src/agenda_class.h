@@ -83,6 +83,7 @@ class Agenda final {
   }
   [[nodiscard]] bool is_main_agenda() const { return main_agenda; }
   [[nodiscard]] bool checked() const { return mchecked; }
+  [[nodiscard]] bool compiled() const { return mcompiled; }
 
   friend ostream& operator<<(ostream& os, const Agenda& a);
 
@@ -112,6 +113,21 @@ class Agenda final {
 
   /** Flag indicating that the agenda was checked for consistency */
   bool mchecked{false};
+
+  /** Flag indicating that check() has set up the execution data below */
+  bool mcompiled{false};
+
+  /** Index of the verbosity WSV, resolved by check() */
+  Index mverbosity_id{-1};
+
+  /** Set by check() if any method of the agenda outputs verbosity */
+  bool mverbosity_out{false};
+
+  /** Per method, the input WSVs that are neither agenda input nor output of
+      an earlier method, so they must be checked for initialization */
+  Array<ArrayOfIndex> mcheck_in;
+
+  void compile(Workspace& ws_in);
 };
 
 /** Method runtime data. In contrast to MdRecord, an object of this
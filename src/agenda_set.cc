@@ -386,6 +386,25 @@ Agenda get_ppath_step_agenda(Workspace& ws, const String& option) {
   return agenda.finalize();
 }
 
+Agenda get_ppvar_propmat_agenda(Workspace& ws, const String& option) {
+  AgendaCreator agenda(ws, "ppvar_propmat_agenda");
+
+  using enum Options::ppvar_propmat_agendaDefaultOptions;
+  switch (Options::toppvar_propmat_agendaDefaultOptionsOrThrow(option)) {
+    case FromPropmatClearskyAgenda:
+      agenda.add("ppvar_propmatCalc");
+      break;
+    case FromLookup:
+      agenda.add("ppvar_propmatInit");
+      agenda.add("ppvar_propmatAddFromLookup");
+      break;
+    case FINAL:
+      break;
+  }
+
+  return agenda.finalize();
+}
+
 Agenda get_refr_index_air_agenda(Workspace& ws, const String& option) {
   AgendaCreator agenda(ws, "refr_index_air_agenda");
 
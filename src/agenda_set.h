@@ -177,6 +177,7 @@ Agenda get_iy_surface_agenda(Workspace& ws, const String& option);
 Agenda get_iy_cloudbox_agenda(Workspace& ws, const String& option);
 Agenda get_ppath_agenda(Workspace& ws, const String& option);
 Agenda get_ppath_step_agenda(Workspace& ws, const String& option);
+Agenda get_ppvar_propmat_agenda(Workspace& ws, const String& option);
 Agenda get_refr_index_air_agenda(Workspace& ws, const String& option);
 Agenda get_water_p_eq_agenda(Workspace& ws, const String& option);
 Agenda get_gas_scattering_agenda(Workspace& ws, const String& option);
@@ -579,6 +579,34 @@ void define_agenda_data() {
       OUTPUT("ppath_step"),
       INPUT("ppath_step", "ppath_lmax", "ppath_lraytrace", "f_grid")));
 
+  agenda_data.push_back(AgRecord(
+      NAME("ppvar_propmat_agenda"),
+      DESCRIPTION(
+          "Calculate the absorption coefficient matrices along a propagation path.\n"
+          "\n"
+          "This agenda does the same as *propmat_clearsky_agenda*, but for all\n"
+          "points of *ppath* in one go. The atmospheric state of the points is\n"
+          "given by *ppvar_p*, *ppvar_t*, *ppvar_nlte*, *ppvar_vmr* and *ppvar_mag*,\n"
+          "and the (Doppler shifted) frequencies of the points by *ppvar_f*.\n"
+          "The result is returned in *ppvar_propmat* and *ppvar_nlte_source*,\n"
+          "with one element per ppath point.\n"
+          "\n"
+          "Use *ppvar_propmatCalc* to fall back on *propmat_clearsky_agenda*\n"
+          "point by point, or methods that handle all points at once, such as\n"
+          "*ppvar_propmatAddFromLookup*.\n"),
+      OUTPUT("ppvar_propmat",
+             "ppvar_nlte_source",
+             "ppvar_dpropmat",
+             "ppvar_dnlte_source"),
+      INPUT("jacobian_quantities",
+            "ppvar_f",
+            "ppvar_mag",
+            "ppath",
+            "ppvar_p",
+            "ppvar_t",
+            "ppvar_nlte",
+            "ppvar_vmr")));
+
   agenda_data.push_back(AgRecord(
       NAME("refr_index_air_agenda"),
       DESCRIPTION(
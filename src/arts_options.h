@@ -86,6 +86,12 @@ ENUMCLASS(ppath_step_agendaDefaultOptions,
           GeometricPath,
           RefractedPath)
 
+/** Options for setting ppvar_propmat_agenda */
+ENUMCLASS(ppvar_propmat_agendaDefaultOptions,
+          char,
+          FromPropmatClearskyAgenda,
+          FromLookup)
+
 /** Options for setting refr_index_air_agenda */
 ENUMCLASS(refr_index_air_agendaDefaultOptions,
           char,
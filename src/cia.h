@@ -41,8 +41,8 @@ Index cia_get_index(const ArrayOfCIARecord& cia_data,
                     const Species::Species sp1,
                     const Species::Species sp2);
 
-std::shared_ptr<CIARecord> cia_get_data(
-    const std::vector<std::shared_ptr<CIARecord>>& cia_data,
+std::shared_ptr<const CIARecord> cia_get_data(
+    const std::vector<std::shared_ptr<const CIARecord>>& cia_data,
     const Species::Species sp1,
     const Species::Species sp2);
 
@@ -10,6 +10,7 @@
 
 #include "disort.h"
 
+#include <algorithm>
 #include <cinttypes>
 #include <cmath>
 #include <cstdlib>
@@ -32,6 +33,7 @@
 #include "interpolation.h"
 #include "logic.h"
 #include "math_funcs.h"
+#include "matpack_math.h"
 #include "messages.h"
 #include "rte.h"
 #include "xml_io.h"
@@ -350,24 +352,48 @@ void get_gasoptprop(Workspace& ws,
   ArrayOfPropagationMatrix partial_dummy;
 
   PropagationMatrix propmat_clearsky_local;
+
+  String fail_msg;
+  bool failed = false;
+
+  // The levels are independent, so each thread gets its own workspace copy
+  WorkspaceOmpParallelCopyGuard wss{ws};
+#pragma omp parallel for if (!arts_omp_in_parallel() && Np > 1) \
+    firstprivate(wss, propmat_clearsky_local, nlte_dummy, partial_dummy, partial_nlte_dummy)
   for (Index ip = 0; ip < Np; ip++) {
-    propmat_clearsky_agendaExecute(ws,
-                                   propmat_clearsky_local,
-                                   nlte_dummy,
-                                   partial_dummy,
-                                   partial_nlte_dummy,
-                                   ArrayOfRetrievalQuantity(0),
-                                   {},
-                                   Vector{f_grid},
-                                   rtp_mag_dummy,
-                                   ppath_los_dummy,
-                                   p_grid[ip],
-                                   t_profile[ip],
-                                   rtp_nlte_dummy,
-                                   Vector{vmr_profiles(joker, ip)},
-                                   propmat_clearsky_agenda);
-    ext_bulk_gas(joker, ip) += propmat_clearsky_local.Kjj();
+    if (failed) continue;
+
+    try {
+      propmat_clearsky_agendaExecute(wss,
+                                     propmat_clearsky_local,
+                                     nlte_dummy,
+                                     partial_dummy,
+                                     partial_nlte_dummy,
+                                     ArrayOfRetrievalQuantity(0),
+                                     {},
+                                     Vector{f_grid},
+                                     rtp_mag_dummy,
+                                     ppath_los_dummy,
+                                     p_grid[ip],
+                                     t_profile[ip],
+                                     rtp_nlte_dummy,
+                                     Vector{vmr_profiles(joker, ip)},
+                                     propmat_clearsky_agenda);
+      ext_bulk_gas(joker, ip) += propmat_clearsky_local.Kjj();
+    } catch (const std::exception& e) {
+      ostringstream os;
+      os << "Error for pressure level " << ip << " (" << p_grid[ip]
+         << " Pa)" << endl
+         << e.what();
+#pragma omp critical(get_gasoptprop_fail)
+      {
+        failed = true;
+        fail_msg = os.str();
+      }
+    }
   }
+
+  ARTS_USER_ERROR_IF(failed, fail_msg);
 }
 
 void get_gas_scattering_properties(Workspace& ws,
@@ -667,6 +693,42 @@ void get_pfct(Tensor3& pfct_bulk_par,
     }
 }
 
+const Matrix& get_pmom_basis(ConstVectorView pfct_angs, const Index Nlegendre) {
+  thread_local Vector angs;
+  thread_local Matrix basis;
+
+  const Index nang = pfct_angs.nelem();
+  if (basis.ncols() == Nlegendre and angs.nelem() == nang and
+      std::equal(angs.begin(), angs.end(), pfct_angs.begin()))
+    return basis;
+
+  angs = pfct_angs;
+  basis.resize(nang, Nlegendre);
+
+  for (Index ia = 0; ia < nang; ia++) {
+    // Half the width of the neighbouring intervals, integrating over the
+    // angle as that is numerically more exact for highly peaked functions
+    Numeric w = 0.;
+    if (ia > 0) w += abs(angs[ia] - angs[ia - 1]) * PI / 180.;
+    if (ia < nang - 1) w += abs(angs[ia + 1] - angs[ia]) * PI / 180.;
+    w *= 0.25 * sin(angs[ia] * PI / 180.);
+
+    const Numeric u = cos(angs[ia] * PI / 180.);
+    Numeric p0 = 1., p1 = u;
+    basis(ia, 0) = w;
+    if (Nlegendre > 1) basis(ia, 1) = w * u;
+    for (Index l = 2; l < Nlegendre; l++) {
+      const Numeric dl = (double)l;
+      const Numeric p2 = (2 * dl - 1) / dl * u * p1 - (dl - 1) / dl * p0;
+      basis(ia, l) = w * p2;
+      p0 = p1;
+      p1 = p2;
+    }
+  }
+
+  return basis;
+}
+
 void get_pmom(Tensor3View pmom,
               ConstTensor3View pfct_bulk_par,
               ConstVectorView pfct_angs,
@@ -686,71 +748,44 @@ void get_pmom(Tensor3View pmom,
   // Initialization
   pmom = 0.;
 
-  // we need the cosine of the pfct angles
-  Vector u(nang), adu(nang - 1), ad_angs(nang - 1);
-  Tensor3 px(nang - 1, Nlegendre, 2, 0.);
-  u[0] = cos(pfct_angs[0] * PI / 180.);
-  px(joker, 0, joker) = 1.;
-  for (Index ia = 1; ia < nang; ia++) {
-    u[ia] = cos(pfct_angs[ia] * PI / 180.);
-    adu[ia - 1] = abs(u[ia] - u[ia - 1]);
-    ad_angs[ia - 1] =
-        abs(pfct_angs[ia] * PI / 180. - pfct_angs[ia - 1] * PI / 180.);
-    px(ia - 1, 1, 0) = u[ia - 1];
-    px(ia - 1, 1, 1) = u[ia];
-    for (Index l = 2; l < Nlegendre; l++) {
-      Numeric dl = (double)l;
-      px(ia - 1, l, 0) = (2 * dl - 1) / dl * u[ia - 1] * px(ia - 1, l - 1, 0) -
-                         (dl - 1) / dl * px(ia - 1, l - 2, 0);
-      px(ia - 1, l, 1) = (2 * dl - 1) / dl * u[ia] * px(ia - 1, l - 1, 1) -
-                         (dl - 1) / dl * px(ia - 1, l - 2, 1);
-    }
-  }
-
+  // Only layers and frequencies with particles have moments
+  ArrayOfIndex f_active, il_active;
   for (Index il = 0; il < nlyr; il++)
-    if (sum(pfct_bulk_par(joker, il, 0)) != 0.)
-      for (Index f_index = 0; f_index < nf; f_index++) {
-        if (pfct_bulk_par(f_index, il, 0) != 0) {
-          Vector pfct{pfct_bulk_par(f_index, il, joker)};
-
-          // Check if phase function is properly normalized
-          // For highly peaked phasefunctions, integrating over the angle instead
-          // of over the cosine of the angle is numerically more exact though both 
-          // ways are analytically equal. Furthermore in *scat_dataCalc* the 
-          // integration is also done over the angle.
-          Numeric pint = 0.;
-          for (Index ia = 0; ia < nang - 1; ia++) {
-            pint += 0.5 * ad_angs[ia] *
-                    (pfct[ia] * sin(pfct_angs[ia] * PI / 180.) +
-                     pfct[ia + 1] * sin(pfct_angs[ia + 1] * PI / 180.));
-          }
+    for (Index f_index = 0; f_index < nf; f_index++)
+      if (pfct_bulk_par(f_index, il, 0) != 0) {
+        f_active.push_back(f_index);
+        il_active.push_back(il);
+      }
+  const Index nactive = f_active.nelem();
+  if (nactive == 0) return;
 
-          if (abs(pint / 2. - 1.) > pfct_threshold) {
-            ostringstream os;
-            os << "Phase function normalization deviates from expected value by\n"
-               << 1e2 * pint / 2. - 1e2 << "(allowed: " << pfct_threshold * 1e2
-               << "%).\n"
-               << "Occurs at layer #" << il << " and frequency #" << f_index
-               << ".\n"
-               << "Something is wrong with your scattering data. Check!\n";
-            throw runtime_error(os.str());
-          }
+  // All moments of all phase functions in one matrix product
+  Matrix pfct(nactive, nang), pmom_active(nactive, Nlegendre);
+  for (Index i = 0; i < nactive; i++)
+    pfct(i, joker) = pfct_bulk_par(f_active[i], il_active[i], joker);
+  mult(pmom_active, pfct, get_pmom_basis(pfct_angs, Nlegendre));
 
-          // for the rest, rescale pfct to norm 2
-          pfct *= 2. / pint;
-
-          pmom(f_index, il, 0) = 1.;
-          for (Index ia = 0; ia < nang - 1; ia++) {
-            for (Index l = 1; l < Nlegendre; l++) {
-              pmom(f_index, il, l) +=
-                  0.25 * ad_angs[ia] *
-                  (px(ia, l, 0) * pfct[ia] * sin(pfct_angs[ia] * PI / 180.) +
-                   px(ia, l, 1) * pfct[ia + 1] *
-                       sin(pfct_angs[ia + 1] * PI / 180.));
-            }
-          }            
-        }
-      }
+  for (Index i = 0; i < nactive; i++) {
+    // The zeroth moment is half the phase function integral
+    const Numeric pint = 2. * pmom_active(i, 0);
+
+    // Check if phase function is properly normalized
+    if (abs(pint / 2. - 1.) > pfct_threshold) {
+      ostringstream os;
+      os << "Phase function normalization deviates from expected value by\n"
+         << 1e2 * pint / 2. - 1e2 << "(allowed: " << pfct_threshold * 1e2
+         << "%).\n"
+         << "Occurs at layer #" << il_active[i] << " and frequency #"
+         << f_active[i] << ".\n"
+         << "Something is wrong with your scattering data. Check!\n";
+      throw runtime_error(os.str());
+    }
+
+    // for the rest, rescale pfct to norm 2
+    pmom(f_active[i], il_active[i], joker) = pmom_active(i, joker);
+    pmom(f_active[i], il_active[i], joker) *= 2. / pint;
+    pmom(f_active[i], il_active[i], 0) = 1.;
+  }
 }
 
 void get_scat_bulk_layer(MatrixView sca_bulk_layer,
@@ -1006,8 +1041,6 @@ void run_cdisort(Workspace& ws,
   Numeric umu0 = 0.;
   //local azimuth angle of sun
   Numeric phi0 = 0.;
-  //Intensity of incident sun beam
-  Numeric fbeam = 0.;
 
   Index N_lev= p_grid.nelem();
 
@@ -1064,10 +1097,6 @@ void run_cdisort(Workspace& ws,
   ds.nphi = static_cast<int>(nphi);
   Index Nlegendre = nstreams + 1;
 
-  /* Allocate memory */
-  c_disort_state_alloc(&ds);
-  c_disort_out_alloc(&ds, &out);
-
   // Looking direction of solar beam
   ds.bc.umu0 = umu0;
   ds.bc.phi0 = phi0;
@@ -1075,16 +1104,6 @@ void run_cdisort(Workspace& ws,
   // Intensity of bottom-boundary isotropic illumination
   ds.bc.fluor = 0.;
 
-  // fill up azimuth angle and temperature array
-  for (Index i = 0; i < ds.nphi; i++) ds.phi[i] = aa_grid[i];
-
-  if  (ds.flag.planck==TRUE){
-    for (Index i = 0; i <= ds.nlyr; i++) ds.temper[i] = t[ds.nlyr - i];
-  }
-
-  // Transform to mu, starting with negative values
-  for (Index i = 0; i < ds.numu; i++) ds.umu[i] = -cos(za_grid[i] * PI / 180);
-
   //gas absorption
   Matrix ext_bulk_gas(nf, ds.nlyr + 1);
   get_gasoptprop(ws, ext_bulk_gas, propmat_clearsky_agenda, t, vmr, p, f_grid);
@@ -1127,208 +1146,256 @@ void run_cdisort(Workspace& ws,
     nlinspace(pfct_angs, 0, 180, nang);
   }
 
-  // loop over all frequencies
-  for (Index f_index = 0; f_index < f_grid.nelem(); f_index++) {
-
-    f_grid_i=f_grid[f_index];
-
-    // Get particle bulk properties
-    if (pnd_non_zero) {
-      if (only_tro && (Npfct < 0 || Npfct > 3)) {
-        ext_bulk_par = 0.0;
-        abs_bulk_par = 0.0;
-        pha_bulk_par = 0.0;
+  String fail_msg;
+  bool failed = false;
 
-        Index iflat = 0;
+  // loop over all frequencies, each thread with its own DISORT state
+  WorkspaceOmpParallelCopyGuard wss{ws};
+#pragma omp parallel if (!arts_omp_in_parallel() && nf > 1) \
+    firstprivate(wss, ds, out, umu0, ext_bulk_par, abs_bulk_par, pha_bulk_par, pfct_bulk_par, pmom, f_grid_i, ssalb, ext_bulk_gas_i, dtauc, sca_coeff_gas_layer, sca_bulk_par_layer, sca_coeff_gas_level, pmom_gas)
+  {
+    // The workers do not see the disort_verbosity set by the calling thread
+    disort_verbosity = quiet == 0 ? verbosity : Verbosity(0, 0, 0);
 
-        for (Index iss = 0; iss < scat_data.nelem(); iss++) {
-          const Index nse = scat_data[iss].nelem();
-          ext_abs_pfun_from_tro(ext_bulk_par,
-                                abs_bulk_par,
-                                pha_bulk_par,
-                                scat_data[iss],
-                                iss,
-                                pnd(Range(iflat, nse), joker),
-                                cboxlims,
-                                t,
-                                pfct_angs,
-                                f_index);
-          iflat += nse;
-        }
-      } else {
-        get_paroptprop(ext_bulk_par,
-                       abs_bulk_par,
-                       scat_data,
-                       pnd,
-                       t,
-                       p,
-                       cboxlims,
-                       f_index);
-        get_parZ(pha_bulk_par, scat_data, pnd, t, pfct_angs, cboxlims, f_index);
-      }
+    /* Allocate memory */
+    c_disort_state_alloc(&ds);
+    c_disort_out_alloc(&ds, &out);
 
-      get_pfct(
-          pfct_bulk_par, pha_bulk_par, ext_bulk_par, abs_bulk_par, cboxlims);
+    // fill up azimuth angle and temperature array
+    for (Index i = 0; i < ds.nphi; i++) ds.phi[i] = aa_grid[i];
 
-      // Legendre's polynomials of phase function
-      get_pmom(pmom, pfct_bulk_par, pfct_angs, Nlegendre);
-    } else {
-      // no particle scattering
-      ext_bulk_par = 0.0;
-      abs_bulk_par = 0.0;
-      pmom = 0.0;
+    if  (ds.flag.planck==TRUE){
+      for (Index i = 0; i <= ds.nlyr; i++) ds.temper[i] = t[ds.nlyr - i];
     }
 
-    if (gas_scattering_do) {
-      // gas scattering
+    // Transform to mu, starting with negative values
+    for (Index i = 0; i < ds.numu; i++) ds.umu[i] = -cos(za_grid[i] * PI / 180);
 
-      // layer averaged particle scattering coefficient
-      get_scat_bulk_layer(sca_bulk_par_layer, ext_bulk_par, abs_bulk_par);
+#pragma omp for
+    for (Index f_index = 0; f_index < nf; f_index++) {
+      if (failed) continue;
 
-      // call gas_scattering_properties
-      get_gas_scattering_properties(ws,
-                                    sca_coeff_gas_layer,
-                                    sca_coeff_gas_level,
-                                    pmom_gas,
-                                    f_grid_i,
-                                    p,
+      try {
+        f_grid_i=f_grid[f_index];
+
+        //Intensity of incident sun beam
+        Numeric fbeam = 0.;
+
+        // Get particle bulk properties
+        if (pnd_non_zero) {
+          if (only_tro && (Npfct < 0 || Npfct > 3)) {
+            ext_bulk_par = 0.0;
+            abs_bulk_par = 0.0;
+            pha_bulk_par = 0.0;
+
+            Index iflat = 0;
+
+            for (Index iss = 0; iss < scat_data.nelem(); iss++) {
+              const Index nse = scat_data[iss].nelem();
+              ext_abs_pfun_from_tro(ext_bulk_par,
+                                    abs_bulk_par,
+                                    pha_bulk_par,
+                                    scat_data[iss],
+                                    iss,
+                                    pnd(Range(iflat, nse), joker),
+                                    cboxlims,
                                     t,
-                                    vmr,
-                                    gas_scattering_agenda);
-
-      // call add_norm_phase_functions
-      add_normed_phase_functions(
-          pmom, sca_bulk_par_layer, pmom_gas, sca_coeff_gas_layer);
-
-      // add gas_scat_ext to ext_bulk_par
-      ext_bulk_par += sca_coeff_gas_level;
-    }
-
-    // Optical depth of layers
-    // Single scattering albedo of layers
-    ext_bulk_gas_i(0,joker)=ext_bulk_gas(f_index, joker);
-    get_dtauc_ssalb(dtauc, ssalb, ext_bulk_gas_i, ext_bulk_par, abs_bulk_par, z);
-
-    //upper boundary conditions:
-    // DISORT offers isotropic incoming radiance or emissivity-scaled planck
-    // emission. Both are applied additively.
-    // We want to have cosmic background radiation, for which ttemp=COSMIC_BG_TEMP
-    // and temis=1 should give identical results to fisot(COSMIC_BG_TEMP). As they
-    // are additive we should use either the one or the other.
-    // Note: previous setup (using fisot) setting temis=0 should be avoided.
-    // Generally, temis!=1 should be avoided since that technically implies a
-    // reflective upper boundary (though it seems that this is not exploited in
-    // DISORT1.2, which we so far use).
-
-    // Cosmic background
-    // we use temis*ttemp as upper boundary specification, hence CBR set to 0.
-    ds.bc.fisot = 0;
-
-    // Top of the atmosphere temperature and emissivity
-    ds.bc.ttemp = COSMIC_BG_TEMP;
-    ds.bc.btemp = surface_skin_t;
-    ds.bc.temis = 1.;
+                                    pfct_angs,
+                                    f_index);
+              iflat += nse;
+            }
+          } else {
+            get_paroptprop(ext_bulk_par,
+                           abs_bulk_par,
+                           scat_data,
+                           pnd,
+                           t,
+                           p,
+                           cboxlims,
+                           f_index);
+            get_parZ(pha_bulk_par, scat_data, pnd, t, pfct_angs, cboxlims, f_index);
+          }
 
+          get_pfct(
+              pfct_bulk_par, pha_bulk_par, ext_bulk_par, abs_bulk_par, cboxlims);
 
-    snprintf(ds.header, 128, "ARTS Calc f_index = %" PRId64, f_index);
+          // Legendre's polynomials of phase function
+          get_pmom(pmom, pfct_bulk_par, pfct_angs, Nlegendre);
+        } else {
+          // no particle scattering
+          ext_bulk_par = 0.0;
+          abs_bulk_par = 0.0;
+          pmom = 0.0;
+        }
 
-    std::memcpy(ds.dtauc,
-                dtauc(0, joker).unsafe_data_handle(),
-                sizeof(Numeric) * ds.nlyr);
-    std::memcpy(ds.ssalb,
-                ssalb(0, joker).unsafe_data_handle(),
-                sizeof(Numeric) * ds.nlyr);
+        if (gas_scattering_do) {
+          // gas scattering
+
+          // layer averaged particle scattering coefficient
+          get_scat_bulk_layer(sca_bulk_par_layer, ext_bulk_par, abs_bulk_par);
+
+          // call gas_scattering_properties
+          get_gas_scattering_properties(wss,
+                                        sca_coeff_gas_layer,
+                                        sca_coeff_gas_level,
+                                        pmom_gas,
+                                        f_grid_i,
+                                        p,
+                                        t,
+                                        vmr,
+                                        gas_scattering_agenda);
+
+          // call add_norm_phase_functions
+          add_normed_phase_functions(
+              pmom, sca_bulk_par_layer, pmom_gas, sca_coeff_gas_layer);
+
+          // add gas_scat_ext to ext_bulk_par
+          ext_bulk_par += sca_coeff_gas_level;
+        }
 
-    // Wavenumber in [1/cm]
-    ds.wvnmhi = ds.wvnmlo = (f_grid[f_index]) / (100. * SPEED_OF_LIGHT);
-    ds.wvnmhi += ds.wvnmhi * 1e-7;
-    ds.wvnmlo -= ds.wvnmlo * 1e-7;
+        // Optical depth of layers
+        // Single scattering albedo of layers
+        ext_bulk_gas_i(0,joker)=ext_bulk_gas(f_index, joker);
+        get_dtauc_ssalb(dtauc, ssalb, ext_bulk_gas_i, ext_bulk_par, abs_bulk_par, z);
+
+        //upper boundary conditions:
+        // DISORT offers isotropic incoming radiance or emissivity-scaled planck
+        // emission. Both are applied additively.
+        // We want to have cosmic background radiation, for which ttemp=COSMIC_BG_TEMP
+        // and temis=1 should give identical results to fisot(COSMIC_BG_TEMP). As they
+        // are additive we should use either the one or the other.
+        // Note: previous setup (using fisot) setting temis=0 should be avoided.
+        // Generally, temis!=1 should be avoided since that technically implies a
+        // reflective upper boundary (though it seems that this is not exploited in
+        // DISORT1.2, which we so far use).
+
+        // Cosmic background
+        // we use temis*ttemp as upper boundary specification, hence CBR set to 0.
+        ds.bc.fisot = 0;
+
+        // Top of the atmosphere temperature and emissivity
+        ds.bc.ttemp = COSMIC_BG_TEMP;
+        ds.bc.btemp = surface_skin_t;
+        ds.bc.temis = 1.;
+
+
+        snprintf(ds.header, 128, "ARTS Calc f_index = %" PRId64, f_index);
+
+        std::memcpy(ds.dtauc,
+                    dtauc(0, joker).unsafe_data_handle(),
+                    sizeof(Numeric) * ds.nlyr);
+        std::memcpy(ds.ssalb,
+                    ssalb(0, joker).unsafe_data_handle(),
+                    sizeof(Numeric) * ds.nlyr);
+
+        // Wavenumber in [1/cm]
+        ds.wvnmhi = ds.wvnmlo = (f_grid[f_index]) / (100. * SPEED_OF_LIGHT);
+        ds.wvnmhi += ds.wvnmhi * 1e-7;
+        ds.wvnmlo -= ds.wvnmlo * 1e-7;
+
+        // set
+        ds.bc.albedo = surface_scalar_reflectivity[f_index];
+
+        // Set irradiance of incident solar beam at top boundary
+        if (suns_do) {
+          fbeam = suns[0].spectrum(f_index, 0)*(ds.wvnmhi - ds.wvnmlo)*
+                  (100 * SPEED_OF_LIGHT)*scale_factor;
+        }
+        ds.bc.fbeam = fbeam;
+
+        std::memcpy(ds.pmom,
+                    pmom(0, joker, joker).unsafe_data_handle(),
+                    sizeof(Numeric) * pmom.nrows() * pmom.ncols());
+
+        enum class Status { FIRST_TRY, RETRY, SUCCESS };
+        Status tries = Status::FIRST_TRY;
+        const Numeric eps = 2e-4; //two times the value defined in cdisort.c:3653
+        do {
+          try {
+            c_disort(&ds, &out);
+            tries = Status::SUCCESS;
+          } catch (const std::runtime_error& e) {
+            //catch cases if solar zenith angle=quadrature angle
+            if (tries == Status::FIRST_TRY) {
+              // change angle
+              if (umu0 < 1 - eps) {
+                umu0 += eps;
+              } else if (umu0 > 1 - eps) {
+                umu0 -= eps;
+              }
+
+              const Numeric shift =
+                  abs(Conversion::acosd(umu0) - Conversion::acosd(ds.bc.umu0));
+              CREATE_OUT1;
+              out1
+                  << "Solar zenith angle coincided with one of the quadrature angles\n"
+                  << "We needed to shift the solar sun angle by " << shift
+                  << "deg.\n";
+
+              ds.bc.umu0 = umu0;
+              tries = Status::RETRY;
+            } else
+              throw e;
+          }
+        } while (tries != Status::SUCCESS);
+
+        for (Index i = 0; i < ds.nphi; i++) {
+          for (Index j = 0; j < ds.numu; j++) {
+            for (Index k = cboxlims[1] - cboxlims[0]; k >= 0; k--) {
+              cloudbox_field(f_index, k + ncboxremoved, 0, 0, j, i, 0) =
+                  out.uu[j + ((ds.nlyr - k - cboxlims[0]) + i * (ds.nlyr + 1)) *
+                                 ds.numu] /
+                  (ds.wvnmhi - ds.wvnmlo) / (100 * SPEED_OF_LIGHT);
+            }
+            // To avoid potential numerical problems at interpolation of the field,
+            // we copy the surface field to underground altitudes
+            for (Index k = ncboxremoved - 1; k >= 0; k--) {
+              cloudbox_field(f_index, k, 0, 0, j, i, 0) =
+                  cloudbox_field(f_index, k + 1, 0, 0, j, i, 0);
+            }
+          }
+        }
 
-    // set
-    ds.bc.albedo = surface_scalar_reflectivity[f_index];
+        for (Index k = cboxlims[1] - cboxlims[0]; k > 0; k--) {
+          deltatau(f_index, k - 1 + ncboxremoved) =
+              dtauc(0, ds.nlyr - k  + cboxlims[0]);
+        }
 
-    // Set irradiance of incident solar beam at top boundary
-    if (suns_do) {
-      fbeam = suns[0].spectrum(f_index, 0)*(ds.wvnmhi - ds.wvnmlo)*
-              (100 * SPEED_OF_LIGHT)*scale_factor;
-    }
-    ds.bc.fbeam = fbeam;
+        for (Index k = cboxlims[1] - cboxlims[0]; k > 0; k--) {
+          snglsctalbedo(f_index, k - 1 + ncboxremoved) =
+              ssalb(0, ds.nlyr - k + cboxlims[0]);
+        }
 
-    std::memcpy(ds.pmom,
-                pmom(0, joker, joker).unsafe_data_handle(),
-                sizeof(Numeric) * pmom.nrows() * pmom.ncols());
+        if (suns_do){
+          directbeam(f_index, cboxlims[1] - cboxlims[0] + ncboxremoved) =
+              suns[0].spectrum(f_index, 0)/PI;
 
-    enum class Status { FIRST_TRY, RETRY, SUCCESS };
-    Status tries = Status::FIRST_TRY;
-    const Numeric eps = 2e-4; //two times the value defined in cdisort.c:3653
-    do {
-      try {
-        c_disort(&ds, &out);
-        tries = Status::SUCCESS;
-      } catch (const std::runtime_error& e) {
-        //catch cases if solar zenith angle=quadrature angle
-        if (tries == Status::FIRST_TRY) {
-          // change angle
-          if (umu0 < 1 - eps) {
-            umu0 += eps;
-          } else if (umu0 > 1 - eps) {
-            umu0 -= eps;
+          for (Index k = cboxlims[1] - cboxlims[0]; k > 0; k--) {
+            directbeam(f_index, k - 1 + ncboxremoved) =
+                directbeam(f_index, k + ncboxremoved) *
+                exp(-dtauc(0, ds.nlyr - k + cboxlims[0])/umu0);
           }
-
-          const Numeric shift =
-              abs(Conversion::acosd(umu0) - Conversion::acosd(ds.bc.umu0));
-          CREATE_OUT1;
-          out1
-              << "Solar zenith angle coincided with one of the quadrature angles\n"
-              << "We needed to shift the solar sun angle by " << shift
-              << "deg.\n";
-
-          ds.bc.umu0 = umu0;
-          tries = Status::RETRY;
-        } else
-          throw e;
-      }
-    } while (tries != Status::SUCCESS);
-
-    for (Index i = 0; i < ds.nphi; i++) {
-      for (Index j = 0; j < ds.numu; j++) {
-        for (Index k = cboxlims[1] - cboxlims[0]; k >= 0; k--) {
-          cloudbox_field(f_index, k + ncboxremoved, 0, 0, j, i, 0) =
-              out.uu[j + ((ds.nlyr - k - cboxlims[0]) + i * (ds.nlyr + 1)) *
-                             ds.numu] /
-              (ds.wvnmhi - ds.wvnmlo) / (100 * SPEED_OF_LIGHT);
         }
-        // To avoid potential numerical problems at interpolation of the field,
-        // we copy the surface field to underground altitudes
-        for (Index k = ncboxremoved - 1; k >= 0; k--) {
-          cloudbox_field(f_index, k, 0, 0, j, i, 0) =
-              cloudbox_field(f_index, k + 1, 0, 0, j, i, 0);
+      } catch (const std::exception& e) {
+        ostringstream os;
+        os << "Error for f_index = " << f_index << " (" << f_grid[f_index]
+           << " Hz)" << endl
+           << e.what();
+#pragma omp critical(run_cdisort_fail)
+        {
+          failed = true;
+          fail_msg = os.str();
         }
       }
     }
 
-    for (Index k = cboxlims[1] - cboxlims[0]; k > 0; k--) {
-      deltatau(f_index, k - 1 + ncboxremoved) =
-          dtauc(0, ds.nlyr - k  + cboxlims[0]);
-    }
-
-    for (Index k = cboxlims[1] - cboxlims[0]; k > 0; k--) {
-      snglsctalbedo(f_index, k - 1 + ncboxremoved) =
-          ssalb(0, ds.nlyr - k + cboxlims[0]);
-    }
-
-    if (suns_do){
-      directbeam(f_index, cboxlims[1] - cboxlims[0] + ncboxremoved) =
-          suns[0].spectrum(f_index, 0)/PI;
-
-      for (Index k = cboxlims[1] - cboxlims[0]; k > 0; k--) {
-        directbeam(f_index, k - 1 + ncboxremoved) =
-            directbeam(f_index, k + ncboxremoved) *
-            exp(-dtauc(0, ds.nlyr - k + cboxlims[0])/umu0);
-      }
-    }
+    /* Free allocated memory */
+    c_disort_out_free(&ds, &out);
+    c_disort_state_free(&ds);
   }
 
+  ARTS_USER_ERROR_IF(failed, fail_msg);
+
   // Allocate aux data
   disort_aux.resize(disort_aux_vars.nelem());
   // Allocate and set (if possible here) iy_aux
@@ -1357,10 +1424,6 @@ void run_cdisort(Workspace& ws,
     }
   }
 
-  /* Free allocated memory */
-  c_disort_out_free(&ds, &out);
-  c_disort_state_free(&ds);
-
   #else
   ARTS_USER_ERROR("Did not compile with -DENABLE_ARTS_LGPL=0")
   #endif
@@ -1554,6 +1617,9 @@ void run_cdisort_flux(Workspace& ws,
     //Intensity of incident sun beam
     Numeric fbeam = 0.;
 
+    // The workers do not see the disort_verbosity set by the calling thread
+    disort_verbosity = quiet == 0 ? verbosity : Verbosity(0, 0, 0);
+
     /* Allocate memory */
     c_disort_state_alloc(&ds);
     c_disort_out_alloc(&ds, &out);
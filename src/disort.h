@@ -468,6 +468,21 @@ void get_pfct(Tensor3& pfct_bulk_par,
               ConstMatrixView abs_bulk_par,
               const ArrayOfIndex& cloudbox_limits);
 
+/** get_pmom_basis
+ *
+ * Legendre basis of the phase function moments.
+ *
+ * Row ia holds the trapezoidal weight of pfct_angs[ia] times the Legendre
+ * polynomials of its cosine, so that the moments of a phase function given
+ * on pfct_angs are its product with this matrix.  The basis is cached per
+ * thread, as DISORT calls get_pmom with the same angles for all frequencies.
+ *
+ * @param[in] pfct_angs Phase function angles [deg]
+ * @param[in] Nlegendre Number of Legendre moments
+ * @return The [nang x Nlegendre] basis
+ */
+const Matrix& get_pmom_basis(ConstVectorView pfct_angs, const Index Nlegendre);
+
 /** get_pmom
  *
  * Calculates Legendre moments of the layer averaged phase functionss (pmom) as
@@ -13,6 +13,7 @@
   ===========================================================================*/
 
 #include "doit.h"
+#include <algorithm>
 #include <cmath>
 #include <cstdlib>
 #include <iostream>
@@ -282,6 +283,49 @@ void cloud_fieldsCalc(Workspace& ws,
   }
 }
 
+namespace {
+thread_local DoitRteCache* doit_rte_cache = nullptr;
+}  // namespace
+
+DoitRteCache::DoitRteCache() : previous(doit_rte_cache) {
+  doit_rte_cache = this;
+}
+
+DoitRteCache::~DoitRteCache() { doit_rte_cache = previous; }
+
+DoitRteCache* DoitRteCache::current() { return doit_rte_cache; }
+
+void DoitRteCache::prepare(Numeric f_mono,
+                           const ArrayOfIndex& cloudbox_limits,
+                           const Vector& za_grid,
+                           Index N_stokes) {
+  if (f == f_mono and limits == cloudbox_limits and
+      za.nelem() == za_grid.nelem() and
+      std::equal(za.begin(), za.end(), za_grid.begin()) and
+      stokes_dim == N_stokes)
+    return;
+
+  f = f_mono;
+  limits = cloudbox_limits;
+  za = za_grid;
+  nza = za.nelem();
+  stokes_dim = N_stokes;
+
+  // Steps start from all levels in the cloudbox
+  steps = Array<DoitRteStep>((limits[1] - limits[0] + 1) * nza);
+  za_done = ArrayOfIndex(nza, 0);
+}
+
+DoitRteStep& DoitRteCache::step(Index p_index, Index za_index) {
+  ARTS_ASSERT(p_index >= limits[0] and p_index <= limits[1]);
+  ARTS_ASSERT(za_index >= 0 and za_index < nza);
+  return steps[(p_index - limits[0]) * nza + za_index];
+}
+
+bool DoitRteCache::done(Index za_index) const { return za_done[za_index]; }
+
+void DoitRteCache::set_done(Index za_index) { za_done[za_index] = 1; }
+
 void cloud_ppath_update1D(Workspace& ws,
                           // Input and output
                           Tensor6View cloudbox_field_mono,
@@ -311,7 +355,55 @@ void cloud_ppath_update1D(Workspace& ws,
                           const Agenda& surface_rtprop_agenda,
                           //const Agenda& surface_rtprop_agenda,
                           const Index& scat_za_interp,
-                          const Verbosity& verbosity) {
+                          const Verbosity& verbosity,
+                          DoitRteStep* rte_step) {
+  // The fixed parts of the step are reused, as only the radiation field
+  // changes between DOIT iterations
+  if (rte_step and rte_step->calculated) {
+    if (not rte_step->inside) return;
+
+    const Ppath& ppath_step = rte_step->ppath_step;
+    const Index stokes_dim = cloudbox_field_mono.ncols();
+
+    Matrix sca_vec_int(stokes_dim, ppath_step.np, 0.);
+    Matrix cloudbox_field_mono_int(stokes_dim, ppath_step.np, 0.);
+    interp_cloud_field1D(sca_vec_int,
+                         cloudbox_field_mono_int,
+                         doit_scat_field,
+                         cloudbox_field_mono,
+                         ppath_step,
+                         rte_step->cloud_gp_p,
+                         rte_step->gp_za,
+                         rte_step->itw,
+                         rte_step->itw_p_za,
+                         za_grid,
+                         scat_za_interp,
+                         verbosity);
+
+    cloud_RT_no_background_cached(cloudbox_field_mono,
+                                  *rte_step,
+                                  sca_vec_int,
+                                  cloudbox_field_mono_int,
+                                  cloudbox_limits,
+                                  p_index,
+                                  za_index);
+
+    // bkgr=2 indicates that the background is the surface
+    if (ppath_what_background(ppath_step) == 2) {
+      cloud_RT_surface(ws,
+                       cloudbox_field_mono,
+                       surface_rtprop_agenda,
+                       f_grid,
+                       f_index,
+                       stokes_dim,
+                       ppath_step,
+                       cloudbox_limits,
+                       za_grid,
+                       za_index);
+    }
+    return;
+  }
+
   Ppath ppath_step;
   // Input variables are checked in the WSMs i_fieldUpdateSeqXXX, from
   // where this function is called.
@@ -345,11 +437,18 @@ void cloud_ppath_update1D(Workspace& ws,
   // cloudbox. Only if the next point lies inside the
   // cloudbox a radiative transfer step caclulation has to
   // be performed.
+  const bool inside = (cloudbox_limits[0] <= ppath_step.gp_p[1].idx &&
+                       cloudbox_limits[1] > ppath_step.gp_p[1].idx) ||
+                      (cloudbox_limits[1] == ppath_step.gp_p[1].idx &&
+                       abs(ppath_step.gp_p[1].fd[0]) < 1e-6);
+
+  if (rte_step) {
+    rte_step->calculated = true;
+    rte_step->ppath_step = ppath_step;
+    rte_step->inside = inside;
+  }
 
-  if ((cloudbox_limits[0] <= ppath_step.gp_p[1].idx &&
-       cloudbox_limits[1] > ppath_step.gp_p[1].idx) ||
-      (cloudbox_limits[1] == ppath_step.gp_p[1].idx &&
-       abs(ppath_step.gp_p[1].fd[0]) < 1e-6)) {
+  if (inside) {
     // Stokes dimension
     const Index stokes_dim = cloudbox_field_mono.ncols();
     // Number of species
@@ -399,26 +498,54 @@ void cloud_ppath_update1D(Workspace& ws,
     // Radiative transfer from one layer to the next, starting
     // at the intersection with the next layer and propagating
     // to the considered point.
-    cloud_RT_no_background(ws,
-                           cloudbox_field_mono,
-                           propmat_clearsky_agenda,
-                           ppath_step,
-                           t_int,
-                           vmr_list_int,
-                           ext_mat_int,
-                           abs_vec_int,
-                           sca_vec_int,
-                           cloudbox_field_mono_int,
-                           p_int,
-                           cloudbox_limits,
-                           f_grid,
-                           f_index,
-                           p_index,
-                           0,
-                           0,
-                           za_index,
-                           0,
-                           verbosity);
+    if (rte_step) {
+      cloud_gridpos1D(rte_step->cloud_gp_p,
+                      rte_step->gp_za,
+                      rte_step->itw,
+                      rte_step->itw_p_za,
+                      ppath_step,
+                      cloudbox_limits,
+                      za_grid);
+      cloud_RT_no_background_precalc(ws,
+                                     *rte_step,
+                                     propmat_clearsky_agenda,
+                                     ppath_step,
+                                     t_int,
+                                     vmr_list_int,
+                                     ext_mat_int,
+                                     abs_vec_int,
+                                     p_int,
+                                     f_grid,
+                                     f_index);
+      cloud_RT_no_background_cached(cloudbox_field_mono,
+                                    *rte_step,
+                                    sca_vec_int,
+                                    cloudbox_field_mono_int,
+                                    cloudbox_limits,
+                                    p_index,
+                                    za_index);
+    } else {
+      cloud_RT_no_background(ws,
+                             cloudbox_field_mono,
+                             propmat_clearsky_agenda,
+                             ppath_step,
+                             t_int,
+                             vmr_list_int,
+                             ext_mat_int,
+                             abs_vec_int,
+                             sca_vec_int,
+                             cloudbox_field_mono_int,
+                             p_int,
+                             cloudbox_limits,
+                             f_grid,
+                             f_index,
+                             p_index,
+                             0,
+                             0,
+                             za_index,
+                             0,
+                             verbosity);
+    }
 
     // bkgr=2 indicates that the background is the surface
     if (bkgr == 2) {
@@ -1520,6 +1647,134 @@ void cloud_RT_no_background(Workspace& ws,
                       joker) = stokes_vec;
 }
 
+void cloud_RT_no_background_precalc(Workspace& ws,
+                                    DoitRteStep& rte_step,
+                                    const Agenda& propmat_clearsky_agenda,
+                                    const Ppath& ppath_step,
+                                    ConstVectorView t_int,
+                                    ConstMatrixView vmr_list_int,
+                                    ConstTensor3View ext_mat_int,
+                                    ConstMatrixView abs_vec_int,
+                                    ConstVectorView p_int,
+                                    ConstVectorView f_grid,
+                                    const Index& f_index) {
+  const Index stokes_dim = abs_vec_int.nrows();
+  const Index nsteps = ppath_step.np - 1;
+
+  rte_step.trans.resize(nsteps, stokes_dim, stokes_dim);
+  rte_step.scat.resize(nsteps, stokes_dim, stokes_dim);
+  rte_step.emission.resize(nsteps, stokes_dim);
+
+  EnergyLevelMap rtp_nlte_dummy;
+
+  // Two propmat_clearsky to average between
+  PropagationMatrix cur_propmat_clearsky;
+  PropagationMatrix prev_propmat_clearsky;
+
+  PropagationMatrix ext_mat_local;
+  StokesVector abs_vec_local;
+  Matrix invK(stokes_dim, stokes_dim);
+  Matrix ImT(stokes_dim, stokes_dim);
+  Vector source(stokes_dim);
+
+  for (Index k = ppath_step.np - 1; k >= 0; k--) {
+    // Save propmat_clearsky from previous level by
+    // swapping it with current level
+    swap(cur_propmat_clearsky, prev_propmat_clearsky);
+
+    //
+    // Calculate scalar gas absorption
+    //
+    const Vector rtp_mag_dummy(3, 0);
+    const Vector ppath_los_dummy;
+
+    StokesVector nlte_dummy;
+    ArrayOfPropagationMatrix partial_dummy;
+    ArrayOfStokesVector partial_nlte_dummy;
+    propmat_clearsky_agendaExecute(ws,
+                                   cur_propmat_clearsky,
+                                   nlte_dummy,
+                                   partial_dummy,
+                                   partial_nlte_dummy,
+                                   ArrayOfRetrievalQuantity(0),
+                                   {},
+                                   Vector{f_grid[Range(f_index, 1)]},
+                                   rtp_mag_dummy,
+                                   ppath_los_dummy,
+                                   p_int[k],
+                                   t_int[k],
+                                   rtp_nlte_dummy,
+                                   Vector{vmr_list_int(joker, k)},
+                                   propmat_clearsky_agenda);
+
+    // We need values at two ppath points before we can average.
+    if (k == ppath_step.np - 1) continue;
+
+    // Average prev_propmat_clearsky with cur_propmat_clearsky
+    prev_propmat_clearsky += cur_propmat_clearsky;
+    prev_propmat_clearsky *= 0.5;
+
+    opt_prop_sum_propmat_clearsky(
+        ext_mat_local, abs_vec_local, prev_propmat_clearsky);
+
+    // Add average particle absorption and extinction
+    abs_vec_local.AddAverageAtPosition(abs_vec_int(joker, k),
+                                       abs_vec_int(joker, k + 1));
+    ext_mat_local.AddAverageAtPosition(ext_mat_int(joker, joker, k),
+                                       ext_mat_int(joker, joker, k + 1));
+
+    const Numeric rte_planck_value =
+        planck(f_grid[f_index], 0.5 * (t_int[k] + t_int[k + 1]));
+
+    // The solution of the RTE with fixed scattered field is
+    // T I + (1 - T) K^-1 (a B + s), see rte_step_doit_replacement
+    MatrixView trans_mat = rte_step.trans(k, joker, joker);
+    compute_transmission_matrix_from_averaged_matrix_at_frequency(
+        trans_mat, ppath_step.lstep[k], ext_mat_local, 0);
+
+    ext_mat_local.MatrixInverseAtPosition(invK);
+    id_mat(ImT);
+    ImT -= trans_mat;
+    mult(rte_step.scat(k, joker, joker), ImT, invK);
+
+    source = abs_vec_local.VectorAtPosition();
+    source *= rte_planck_value;
+    mult(rte_step.emission(k, joker), rte_step.scat(k, joker, joker), source);
+  }
+}
+
+void cloud_RT_no_background_cached(Tensor6View cloudbox_field_mono,
+                                   const DoitRteStep& rte_step,
+                                   ConstMatrixView sca_vec_int,
+                                   ConstMatrixView cloudbox_field_mono_int,
+                                   const ArrayOfIndex& cloudbox_limits,
+                                   const Index& p_index,
+                                   const Index& za_index) {
+  const Index stokes_dim = cloudbox_field_mono.ncols();
+
+  Vector sca_vec_av(stokes_dim);
+  Vector term1(stokes_dim);
+  Vector term2(stokes_dim);
+
+  // Incoming stokes vector
+  Vector stokes_vec{
+      cloudbox_field_mono_int(joker, rte_step.ppath_step.np - 1)};
+
+  for (Index k = rte_step.ppath_step.np - 2; k >= 0; k--) {
+    for (Index i = 0; i < stokes_dim; i++)
+      sca_vec_av[i] = 0.5 * (sca_vec_int(i, k) + sca_vec_int(i, k + 1));
+
+    mult(term1, rte_step.trans(k, joker, joker), stokes_vec);
+    mult(term2, rte_step.scat(k, joker, joker), sca_vec_av);
+
+    for (Index i = 0; i < stokes_dim; i++)
+      stokes_vec[i] = term1[i] + term2[i] + rte_step.emission(k, i);
+  }
+
+  cloudbox_field_mono(p_index - cloudbox_limits[0], 0, 0, za_index, 0, joker) =
+      stokes_vec;
+}
+
 void cloud_RT_surface(Workspace& ws,
                       //Output
                       Tensor6View cloudbox_field_mono,
@@ -1668,37 +1923,130 @@ void cloudbox_field_ngAcceleration(Tensor6& cloudbox_field_mono,
   }
 }
 
-void interp_cloud_coeff1D(  //Output
-    Tensor3View ext_mat_int,
-    MatrixView abs_vec_int,
-    MatrixView sca_vec_int,
-    MatrixView cloudbox_field_mono_int,
-    VectorView t_int,
-    MatrixView vmr_list_int,
-    VectorView p_int,
-    //Input
-    ConstTensor5View ext_mat_field,
-    ConstTensor4View abs_vec_field,
-    ConstTensor6View doit_scat_field,
-    ConstTensor6View cloudbox_field_mono,
-    ConstTensor3View t_field,
-    ConstTensor4View vmr_field,
-    ConstVectorView p_grid,
-    const Ppath& ppath_step,
-    const ArrayOfIndex& cloudbox_limits,
-    ConstVectorView za_grid,
-    const Index& scat_za_interp,
-    const Verbosity& verbosity) {
-  CREATE_OUT3;
+Index cloudbox_field_andersonAcceleration(Tensor6& cloudbox_field_mono,
+                                          const ArrayOfTensor6& anderson_input,
+                                          const ArrayOfTensor6& anderson_output,
+                                          const Verbosity& verbosity) {
+  CREATE_OUT2;
 
-  // Stokes dimension
-  const Index stokes_dim = cloudbox_field_mono.ncols();
+  // Largest ratio of the diagonal elements of R accepted before the older
+  // residual changes are considered linearly dependent on the newer ones
+  constexpr Numeric max_condition = 1e8;
+
+  const Index m = anderson_input.nelem() - 1;
+  const Index n = cloudbox_field_mono.size();
+  ARTS_ASSERT(m > 0 and anderson_output.nelem() == m + 1);
+
+  // Residuals of the latest iteration and their changes between iterations.
+  // The changes are stored newest first as rows of Q, so that dropping the
+  // oldest ones only truncates the QR factorization.
+  Vector f(n);
+  Matrix Q(m, n, 0.0);
+  for (Index k = 0; k <= m; k++) {
+    ARTS_ASSERT(anderson_input[k].size() == n and
+                anderson_output[k].size() == n);
+    const Numeric* x = anderson_input[k].data_handle();
+    const Numeric* g = anderson_output[k].data_handle();
+    for (Index i = 0; i < n; i++) {
+      const Numeric r = g[i] - x[i];
+      if (k < m) Q(m - 1 - k, i) -= r;
+      if (k > 0) Q(m - k, i) += r;
+      if (k == m) f[i] = r;
+    }
+  }
+
+  // Modified Gram-Schmidt with reorthogonalization, stopping at the first
+  // change that would make R too ill-conditioned
+  Matrix R(m, m, 0.0);
+  Index nused = 0;
+  Numeric rmin = 0, rmax = 0;
+  for (; nused < m; nused++) {
+    auto q = Q[nused];
+    for (Index pass = 0; pass < 2; pass++) {
+      for (Index l = 0; l < nused; l++) {
+        const Numeric h = Q[l] * q;
+        R(l, nused) += h;
+        for (Index i = 0; i < n; i++) q[i] -= h * Q(l, i);
+      }
+    }
+
+    const Numeric rjj = std::sqrt(q * q);
+    const Numeric new_rmin = nused ? std::min(rmin, rjj) : rjj;
+    const Numeric new_rmax = nused ? std::max(rmax, rjj) : rjj;
+    if (not(new_rmin > 0) or new_rmax > max_condition * new_rmin) break;
+
+    rmin = new_rmin;
+    rmax = new_rmax;
+    R(nused, nused) = rjj;
+    q /= rjj;
+  }
+
+  if (nused == 0) {
+    out2 << "  Anderson acceleration skipped, singular residuals.\n";
+    return 0;
+  }
+
+  // Least squares solution of dF gamma = f from R gamma = Q^T f
+  Vector gamma(nused);
+  for (Index j = nused - 1; j >= 0; j--) {
+    Numeric c = Q[j] * f;
+    for (Index l = j + 1; l < nused; l++) c -= R(j, l) * gamma[l];
+    gamma[j] = c / R(j, j);
+  }
+
+  Numeric* x = cloudbox_field_mono.data_handle();
+  for (Index j = 0; j < nused; j++) {
+    const Numeric* g0 = anderson_output[m - 1 - j].data_handle();
+    const Numeric* g1 = anderson_output[m - j].data_handle();
+    for (Index i = 0; i < n; i++) x[i] -= gamma[j] * (g1[i] - g0[i]);
+  }
 
+  out2 << "  Anderson acceleration over " << nused
+       << " iterations, residual norm: " << std::sqrt(f * f) << "\n";
+
+  return nused;
+}
+
+void cloudbox_field_andersonUpdate(Tensor6& cloudbox_field_mono,
+                                   ArrayOfTensor6& anderson_input,
+                                   ArrayOfTensor6& anderson_output,
+                                   Tensor6 cloudbox_field_mono_old,
+                                   const Index& anderson_depth,
+                                   const Verbosity& verbosity) {
+  ARTS_ASSERT(anderson_depth > 0 and
+              anderson_input.nelem() == anderson_output.nelem());
+
+  if (anderson_input.nelem() > anderson_depth) {
+    anderson_input.erase(anderson_input.begin());
+    anderson_output.erase(anderson_output.begin());
+  }
+  anderson_input.push_back(std::move(cloudbox_field_mono_old));
+  anderson_output.push_back(cloudbox_field_mono);
+
+  if (anderson_input.nelem() > 1) {
+    // Drop the iterations that were left out as linearly dependent
+    const Index nused = cloudbox_field_andersonAcceleration(
+        cloudbox_field_mono, anderson_input, anderson_output, verbosity);
+    const Index ndrop = anderson_input.nelem() - 1 - nused;
+    anderson_input.erase(anderson_input.begin(),
+                         anderson_input.begin() + ndrop);
+    anderson_output.erase(anderson_output.begin(),
+                          anderson_output.begin() + ndrop);
+  }
+}
+
+void cloud_gridpos1D(ArrayOfGridPos& cloud_gp_p,
+                     ArrayOfGridPos& gp_za,
+                     Matrix& itw,
+                     Matrix& itw_p_za,
+                     const Ppath& ppath_step,
+                     const ArrayOfIndex& cloudbox_limits,
+                     ConstVectorView za_grid) {
   // Gridpositions inside the cloudbox.
   // The optical properties are stored only inside the
   // cloudbox. For interpolation we use grids
   // inside the cloudbox.
-  ArrayOfGridPos cloud_gp_p = ppath_step.gp_p;
+  cloud_gp_p = ppath_step.gp_p;
 
   for (Index i = 0; i < ppath_step.np; i++)
     cloud_gp_p[i].idx -= cloudbox_limits[0];
@@ -1708,44 +2056,39 @@ void interp_cloud_coeff1D(  //Output
   gridpos_upperend_check(cloud_gp_p[0], n1);
   gridpos_upperend_check(cloud_gp_p[ppath_step.np - 1], n1);
 
-  Matrix itw(cloud_gp_p.nelem(), 2);
+  itw.resize(cloud_gp_p.nelem(), 2);
   interpweights(itw, cloud_gp_p);
 
   // The zenith angles of the propagation path are needed as we have to
   // interpolate the intensity field and the scattered field on the
   // right angles.
-  Vector los_grid{ppath_step.los(joker, 0)};
+  const Vector los_grid{ppath_step.los(joker, 0)};
 
-  ArrayOfGridPos gp_za(los_grid.nelem());
+  gp_za.resize(los_grid.nelem());
   gridpos(gp_za, za_grid, los_grid);
 
-  Matrix itw_p_za(cloud_gp_p.nelem(), 4);
+  itw_p_za.resize(cloud_gp_p.nelem(), 4);
   interpweights(itw_p_za, cloud_gp_p, gp_za);
+}
 
-  // Calculate the average of the coefficients for the layers
-  // to be considered in the
-  // radiative transfer calculation.
+void interp_cloud_field1D(MatrixView sca_vec_int,
+                          MatrixView cloudbox_field_mono_int,
+                          ConstTensor6View doit_scat_field,
+                          ConstTensor6View cloudbox_field_mono,
+                          const Ppath& ppath_step,
+                          const ArrayOfGridPos& cloud_gp_p,
+                          const ArrayOfGridPos& gp_za,
+                          ConstMatrixView itw,
+                          ConstMatrixView itw_p_za,
+                          ConstVectorView za_grid,
+                          const Index& scat_za_interp,
+                          const Verbosity& verbosity) {
+  CREATE_OUT3;
+
+  const Index stokes_dim = cloudbox_field_mono.ncols();
+  const Vector los_grid{ppath_step.los(joker, 0)};
 
   for (Index i = 0; i < stokes_dim; i++) {
-    // Extinction matrix requires a second loop
-    // over stokes_dim
-    out3 << "Interpolate ext_mat:\n";
-    for (Index j = 0; j < stokes_dim; j++) {
-      //
-      // Interpolation of ext_mat
-      //
-      interp(ext_mat_int(i, j, joker),
-             itw,
-             ext_mat_field(joker, 0, 0, i, j),
-             cloud_gp_p);
-    }
-    // Particle absorption vector:
-    //
-    // Interpolation of abs_vec
-    //  //
-    out3 << "Interpolate abs_vec:\n";
-    interp(
-        abs_vec_int(i, joker), itw, abs_vec_field(joker, 0, 0, i), cloud_gp_p);
     //
     // Scattered field:
     //
@@ -1797,6 +2140,78 @@ void interp_cloud_coeff1D(  //Output
       }
     }
   }
+}
+
+void interp_cloud_coeff1D(  //Output
+    Tensor3View ext_mat_int,
+    MatrixView abs_vec_int,
+    MatrixView sca_vec_int,
+    MatrixView cloudbox_field_mono_int,
+    VectorView t_int,
+    MatrixView vmr_list_int,
+    VectorView p_int,
+    //Input
+    ConstTensor5View ext_mat_field,
+    ConstTensor4View abs_vec_field,
+    ConstTensor6View doit_scat_field,
+    ConstTensor6View cloudbox_field_mono,
+    ConstTensor3View t_field,
+    ConstTensor4View vmr_field,
+    ConstVectorView p_grid,
+    const Ppath& ppath_step,
+    const ArrayOfIndex& cloudbox_limits,
+    ConstVectorView za_grid,
+    const Index& scat_za_interp,
+    const Verbosity& verbosity) {
+  CREATE_OUT3;
+
+  // Stokes dimension
+  const Index stokes_dim = cloudbox_field_mono.ncols();
+
+  ArrayOfGridPos cloud_gp_p, gp_za;
+  Matrix itw, itw_p_za;
+  cloud_gridpos1D(
+      cloud_gp_p, gp_za, itw, itw_p_za, ppath_step, cloudbox_limits, za_grid);
+
+  // Calculate the average of the coefficients for the layers
+  // to be considered in the
+  // radiative transfer calculation.
+
+  for (Index i = 0; i < stokes_dim; i++) {
+    // Extinction matrix requires a second loop
+    // over stokes_dim
+    out3 << "Interpolate ext_mat:\n";
+    for (Index j = 0; j < stokes_dim; j++) {
+      //
+      // Interpolation of ext_mat
+      //
+      interp(ext_mat_int(i, j, joker),
+             itw,
+             ext_mat_field(joker, 0, 0, i, j),
+             cloud_gp_p);
+    }
+    // Particle absorption vector:
+    //
+    // Interpolation of abs_vec
+    //  //
+    out3 << "Interpolate abs_vec:\n";
+    interp(
+        abs_vec_int(i, joker), itw, abs_vec_field(joker, 0, 0, i), cloud_gp_p);
+  }
+
+  interp_cloud_field1D(sca_vec_int,
+                       cloudbox_field_mono_int,
+                       doit_scat_field,
+                       cloudbox_field_mono,
+                       ppath_step,
+                       cloud_gp_p,
+                       gp_za,
+                       itw,
+                       itw_p_za,
+                       za_grid,
+                       scat_za_interp,
+                       verbosity);
+
   //
   // Planck function
   //
@@ -1826,6 +2241,84 @@ void interp_cloud_coeff1D(  //Output
   itw2p(p_int, p_grid, ppath_step.gp_p, itw);
 }
 
+Matrix doit_scat_field_weights(ConstVectorView za_grid,
+                               ConstVectorView aa_grid,
+                               ConstVectorView grid_stepsize) {
+  constexpr Numeric DEG2RAD = Conversion::deg2rad(1);
+  const Index nza = za_grid.nelem();
+  const Index naa = aa_grid.nelem();
+
+  Matrix weights(nza, naa, 0.);
+  if (naa == 1) {
+    for (Index i = 0; i < nza - 1; i++) {
+      const Numeric w = 0.5 * DEG2RAD * (za_grid[i + 1] - za_grid[i]);
+      weights(i, 0) += w * sin(za_grid[i] * DEG2RAD);
+      weights(i + 1, 0) += w * sin(za_grid[i + 1] * DEG2RAD);
+    }
+  } else {
+    // Trapezoidal rule on equidistant grids, inner points count twice
+    for (Index i = 0; i < nza; i++) {
+      const Numeric wza = (i == 0 or i == nza - 1 ? 1. : 2.) * 0.5 * DEG2RAD *
+                          grid_stepsize[0] * 0.5 * DEG2RAD * grid_stepsize[1] *
+                          sin(za_grid[i] * DEG2RAD);
+      for (Index j = 0; j < naa; j++)
+        weights(i, j) = (j == 0 or j == naa - 1 ? 1. : 2.) * wza;
+    }
+  }
+  return weights;
+}
+
+void doit_scat_field1D(MatrixView doit_scat_field,
+                       Matrix& pha_mat_level,
+                       Vector& field_weighted,
+                       const Tensor7& pha_mat_doit,
+                       const Index& p_index,
+                       ConstMatrixView cloudbox_field,
+                       ConstMatrixView weights) {
+  const Index nza_out = doit_scat_field.nrows();
+  const Index stokes_dim = doit_scat_field.ncols();
+  const Index nza = weights.nrows();
+  const Index naa = weights.ncols();
+  const Index nin = nza * naa * stokes_dim;
+
+  ARTS_ASSERT(is_size(cloudbox_field, nza, stokes_dim));
+  ARTS_ASSERT(p_index < pha_mat_doit.nlibraries());
+  ARTS_ASSERT(pha_mat_doit.nvitrines() == nza_out and
+              pha_mat_doit.nshelves() == 1 and pha_mat_doit.nbooks() == nza and
+              pha_mat_doit.npages() == naa and
+              pha_mat_doit.nrows() == stokes_dim and
+              pha_mat_doit.ncols() == stokes_dim);
+
+  // The buffers are only allocated by the first call
+  if (not is_size(pha_mat_level, nza_out * stokes_dim, nin))
+    pha_mat_level.resize(nza_out * stokes_dim, nin);
+  if (not is_size(field_weighted, nin)) field_weighted.resize(nin);
+
+  // Phase matrices of the level with the outgoing Stokes component moved
+  // next to the outgoing direction and the incoming one next to the
+  // incoming direction
+  const Numeric* pha = pha_mat_doit.data_handle() +
+                       p_index * nza_out * nin * stokes_dim;
+  for (Index za_out = 0; za_out < nza_out; za_out++)
+    for (Index in = 0; in < nza * naa; in++)
+      for (Index i = 0; i < stokes_dim; i++)
+        for (Index j = 0; j < stokes_dim; j++)
+          pha_mat_level(za_out * stokes_dim + i, in * stokes_dim + j) = *pha++;
+
+  for (Index za_in = 0; za_in < nza; za_in++)
+    for (Index aa_in = 0; aa_in < naa; aa_in++)
+      for (Index j = 0; j < stokes_dim; j++)
+        field_weighted[(za_in * naa + aa_in) * stokes_dim + j] =
+            weights(za_in, aa_in) * cloudbox_field(za_in, j);
+
+  // The rows of each outgoing Stokes component are strided
+  for (Index i = 0; i < stokes_dim; i++) {
+    mult(doit_scat_field(joker, i),
+         pha_mat_level(Range(i, nza_out, stokes_dim), joker),
+         field_weighted);
+  }
+}
+
 void za_gridOpt(  //Output:
     Vector& za_grid_opt,
     Matrix& cloudbox_field_opt,
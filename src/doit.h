@@ -17,6 +17,7 @@
 #define doit_h
 
 #include "agenda_class.h"
+#include "array.h"
 #include "matpack_data.h"
 #include "ppath.h"
 #include "propagationmatrix.h"
@@ -114,6 +115,95 @@ void cloud_fieldsCalc(Workspace& ws,
                       ConstTensor4View pnd_field,
                       const Verbosity& verbosity);
 
+//! The parts of a 1D radiative transfer step that stay fixed in DOIT
+/*!
+  The propagation path step, the interpolation weights on it and the gas
+  and particle extinction along it do not depend on the radiation field.
+  Neither does the transmission of each path step, nor the thermal
+  emission and the operator acting on the scattered field derived from it.
+  Only the radiances need updating in each DOIT iteration.
+
+  All members but calculated are set when the step is first calculated.
+*/
+struct DoitRteStep {
+  //! Whether the step is calculated
+  bool calculated{false};
+  //! Propagation path step from the level
+  Ppath ppath_step;
+  //! Whether the end of the step is inside the cloudbox
+  bool inside{false};
+  //! Grid positions of the path points inside the cloudbox
+  ArrayOfGridPos cloud_gp_p;
+  //! Grid positions of the path points in za_grid
+  ArrayOfGridPos gp_za;
+  //! Interpolation weights of cloud_gp_p
+  Matrix itw;
+  //! Interpolation weights of cloud_gp_p and gp_za
+  Matrix itw_p_za;
+  //! Transmission matrix of each path step, [np - 1, stokes_dim, stokes_dim]
+  Tensor3 trans;
+  //! (1 - T) K^-1 of each path step, to apply to the scattered field
+  Tensor3 scat;
+  //! (1 - T) K^-1 a B, the thermal emission of each path step
+  Matrix emission;
+};
+
+//! Keeps the fixed parts of the DOIT radiative transfer between iterations
+/*!
+  Geometry and clear-sky absorption do not change while cloudbox_field_mono
+  converges.  An object of this class makes itself the cache of its thread
+  for its lifetime.  cloudbox_field_monoIterate holds one while iterating,
+  so that cloudbox_fieldUpdateSeq1D calculates the DoitRteStep of each
+  level and direction in the first iteration and reuses them afterwards.
+
+  The cache is cleared whenever it is used with another frequency, other
+  cloudbox limits or another zenith angle grid, so an unrelated use on the
+  same thread is still correct.  The atmosphere is not compared, it must
+  not change while the cache is held.
+*/
+class DoitRteCache {
+  DoitRteCache* previous;
+  Numeric f{-1};
+  ArrayOfIndex limits;
+  Vector za;
+  Index nza{0};
+  Index stokes_dim{0};
+  Array<DoitRteStep> steps;
+  ArrayOfIndex za_done;
+
+ public:
+  DoitRteCache();
+  DoitRteCache(const DoitRteCache&) = delete;
+  DoitRteCache(DoitRteCache&&) = delete;
+  DoitRteCache& operator=(const DoitRteCache&) = delete;
+  DoitRteCache& operator=(DoitRteCache&&) = delete;
+  ~DoitRteCache();
+
+  //! The cache of the calling thread, or nullptr if there is none
+  static DoitRteCache* current();
+
+  //! Prepares for a frequency, clearing all steps if anything changed
+  /*!
+    \param[in] f_mono Frequency of the calculation
+    \param[in] cloudbox_limits Cloudbox limits
+    \param[in] za_grid Zenith angle grid
+    \param[in] N_stokes Stokes dimension
+  */
+  void prepare(Numeric f_mono,
+               const ArrayOfIndex& cloudbox_limits,
+               const Vector& za_grid,
+               Index N_stokes);
+
+  //! The step from pressure level p_index in direction za_index
+  DoitRteStep& step(Index p_index, Index za_index);
+
+  //! Whether all steps in direction za_index are calculated
+  [[nodiscard]] bool done(Index za_index) const;
+
+  //! Marks all steps in direction za_index as calculated
+  void set_done(Index za_index);
+};
+
 //! Calculates radiation field along a propagation path step for specified
 //! zenith direction and pressure level.
 /*!
@@ -153,6 +243,8 @@ void cloud_fieldsCalc(Workspace& ws,
   \param[in]    scat_za_interp Flag for interplation method in zenith angle
                 dimension
   \param[in]    verbosity Verbosity setting
+  \param[in,out] rte_step If not nullptr, the fixed parts of the step are
+                taken from here, and calculated into it if it is empty
 
   \author Claudia Emde
   \date 2003-06-04
@@ -185,7 +277,8 @@ void cloud_ppath_update1D(Workspace& ws,
                           ConstTensor4View abs_vec_field,
                           const Agenda& surface_rtprop_agenda,
                           const Index& scat_za_interp,
-                          const Verbosity& verbosity);
+                          const Verbosity& verbosity,
+                          DoitRteStep* rte_step = nullptr);
 
 //! Calculation of radiation field along a propagation path step for specified
 //! zenith direction and pressure level.
@@ -456,6 +549,58 @@ void cloud_RT_no_background(Workspace& ws,
                             const Index& aa_index,
                             const Verbosity& verbosity);
 
+//! Calculates the fixed parts of cloud_RT_no_background (1D)
+/*!
+  Runs the gas absorption on the propagation path step and sets the
+  transmission, emission and scattering operator of each path step in
+  rte_step, see DoitRteStep.
+
+  \param[in,out] ws Current workspace
+  \param[in,out] rte_step Step to set trans, scat and emission of
+  \param[in]     propmat_clearsky_agenda Calculate gas absorption
+  \param[in]     ppath_step Propagation path step from one pressure level to the next
+  \param[in]     t_int Temperature values interpolated on propagation path points
+  \param[in]     vmr_list_int Interpolated volume mixing ratios
+  \param[in]     ext_mat_int Interpolated total particle extinction matrix
+  \param[in]     abs_vec_int Interpolated total particle absorption vector
+  \param[in]     p_int Interpolated pressure values
+  \param[in]     f_grid Frequency grid
+  \param[in]     f_index Frequency index of (monochromatic) scattering
+                 calculation
+*/
+void cloud_RT_no_background_precalc(Workspace& ws,
+                                    DoitRteStep& rte_step,
+                                    const Agenda& propmat_clearsky_agenda,
+                                    const Ppath& ppath_step,
+                                    ConstVectorView t_int,
+                                    ConstMatrixView vmr_list_int,
+                                    ConstTensor3View ext_mat_int,
+                                    ConstMatrixView abs_vec_int,
+                                    ConstVectorView p_int,
+                                    ConstVectorView f_grid,
+                                    const Index& f_index);
+
+//! Calculates RT in the cloudbox (1D) from a precalculated step
+/*!
+  Same as cloud_RT_no_background, but with the fixed parts taken from
+  rte_step, see cloud_RT_no_background_precalc.
+
+  \param[out]    cloudbox_field_mono Radiation field in cloudbox
+  \param[in]     rte_step Precalculated step
+  \param[in]     sca_vec_int Interpolated total particle scattering vector
+  \param[in]     cloudbox_field_mono_int Interpolated radiances
+  \param[in]     cloudbox_limits Cloudbox limits
+  \param[in]     p_index Pressure index in *cloudbox_field_mono*
+  \param[in]     za_index Zenith angle index in *cloudbox_field_mono*
+*/
+void cloud_RT_no_background_cached(Tensor6View cloudbox_field_mono,
+                                   const DoitRteStep& rte_step,
+                                   ConstMatrixView sca_vec_int,
+                                   ConstMatrixView cloudbox_field_mono_int,
+                                   const ArrayOfIndex& cloudbox_limits,
+                                   const Index& p_index,
+                                   const Index& za_index);
+
 //! Calculates RT in the cloudbox
 /*!
   This function calculates RT in the cloudbox if the next intersected
@@ -515,6 +660,65 @@ void cloudbox_field_ngAcceleration(  //Output
     const Index& accelerated,
     const Verbosity& verbosity);
 
+//! Convergence acceleration by Anderson mixing
+/*!
+ Treats one DOIT iteration, scattering integral plus radiative transfer,
+ as a fixed-point map G and replaces its latest result by the combination
+ of the previous results whose residual, G(x) - x, is smallest in the
+ least squares sense (Anderson mixing).  Unlike Ng-Acceleration, it is
+ applied after every iteration and uses all Stokes components.
+
+ The least squares problem is solved by a QR factorization of the residual
+ changes, newest first.  The oldest changes are left out if they would make
+ the condition number estimate of R, the ratio of its largest and smallest
+ diagonal element, exceed 1e8.  The mixing is skipped if not even the
+ newest change can be used.
+
+ \param[in,out] cloudbox_field_mono Radiation field in cloudbox, on input
+                the result of the latest iteration, G of the last input
+ \param[in]     anderson_input Fields the previous iterations started from,
+                oldest first, at least two
+ \param[in]     anderson_output Fields the previous iterations resulted in,
+                in the same order
+ \param[in]     verbosity Verbosity setting
+ \return        The number of residual changes used, the older ones do not
+                need to be kept
+*/
+Index cloudbox_field_andersonAcceleration(  //Output
+    Tensor6& cloudbox_field_mono,
+    //Input
+    const ArrayOfTensor6& anderson_input,
+    const ArrayOfTensor6& anderson_output,
+    const Verbosity& verbosity);
+
+//! Anderson mixing of the latest DOIT iteration with the previous ones
+/*!
+ Adds the latest iteration to the history of iterations, keeping at most
+ anderson_depth + 1 of them, and replaces its result by the Anderson mixing
+ of the history with cloudbox_field_andersonAcceleration.  The iterations
+ that the mixing leaves out as linearly dependent are dropped from the
+ history, as they would also be left out of the following mixings.
+
+ \param[in,out] cloudbox_field_mono Radiation field in cloudbox, on input
+                the result of the latest iteration
+ \param[in,out] anderson_input Fields the previous iterations started from,
+                oldest first, empty before the first iteration
+ \param[in,out] anderson_output Fields the previous iterations resulted in,
+                in the same order
+ \param[in]     cloudbox_field_mono_old Field the latest iteration started
+                from
+ \param[in]     anderson_depth Number of previous iterations to mix with
+ \param[in]     verbosity Verbosity setting
+*/
+void cloudbox_field_andersonUpdate(  //Output
+    Tensor6& cloudbox_field_mono,
+    ArrayOfTensor6& anderson_input,
+    ArrayOfTensor6& anderson_output,
+    //Input
+    Tensor6 cloudbox_field_mono_old,
+    const Index& anderson_depth,
+    const Verbosity& verbosity);
+
 //! Interpolate all inputs of the VRTE on a propagation path step
 /*!
   Used in the WSM cloud_ppath_update1D.
@@ -566,6 +770,102 @@ void interp_cloud_coeff1D(  //Output
     const Index& scat_za_interp,
     const Verbosity& verbosity);
 
+//! Grid positions and interpolation weights of a propagation path step (1D)
+/*!
+  Used by interp_cloud_coeff1D.
+
+  \param[out]   cloud_gp_p Grid positions of the path points inside the cloudbox
+  \param[out]   gp_za Grid positions of the path points in za_grid
+  \param[out]   itw Interpolation weights of cloud_gp_p
+  \param[out]   itw_p_za Interpolation weights of cloud_gp_p and gp_za
+  \param[in]    ppath_step Propagation path step
+  \param[in]    cloudbox_limits Cloudbox limits
+  \param[in]    za_grid Zenith angle grid
+*/
+void cloud_gridpos1D(ArrayOfGridPos& cloud_gp_p,
+                     ArrayOfGridPos& gp_za,
+                     Matrix& itw,
+                     Matrix& itw_p_za,
+                     const Ppath& ppath_step,
+                     const ArrayOfIndex& cloudbox_limits,
+                     ConstVectorView za_grid);
+
+//! Interpolate the scattered and radiation field on a propagation path step
+/*!
+  Used by interp_cloud_coeff1D, and alone for a DoitRteStep.
+
+  \param[out]   sca_vec_int Interpolated scattering field for 1D atmosphere
+  \param[out]   cloudbox_field_mono_int Interpolated radiation field
+                for 1D atmosphere
+  \param[in]    doit_scat_field Scattering field
+  \param[in]    cloudbox_field_mono Radiation field
+  \param[in]    ppath_step Propagation path step
+  \param[in]    cloud_gp_p See cloud_gridpos1D
+  \param[in]    gp_za See cloud_gridpos1D
+  \param[in]    itw See cloud_gridpos1D
+  \param[in]    itw_p_za See cloud_gridpos1D
+  \param[in]    za_grid Zenith angle grid
+  \param[in]    scat_za_interp Flag for interplation method in zenith angle
+                dimension
+  \param[in]    verbosity Verbosity setting
+*/
+void interp_cloud_field1D(MatrixView sca_vec_int,
+                          MatrixView cloudbox_field_mono_int,
+                          ConstTensor6View doit_scat_field,
+                          ConstTensor6View cloudbox_field_mono,
+                          const Ppath& ppath_step,
+                          const ArrayOfGridPos& cloud_gp_p,
+                          const ArrayOfGridPos& gp_za,
+                          ConstMatrixView itw,
+                          ConstMatrixView itw_p_za,
+                          ConstVectorView za_grid,
+                          const Index& scat_za_interp,
+                          const Verbosity& verbosity);
+
+//! Integration weights of the DOIT scattering integral
+/*!
+  Summing an integrand times these weights gives the same as
+  AngIntegrate_trapezoid / 2 / PI for a single azimuth angle, and as
+  AngIntegrate_trapezoid_opti with grid_stepsize for several.
+
+  \param[in]    za_grid Equidistant zenith angle grid
+  \param[in]    aa_grid Azimuth angle grid
+  \param[in]    grid_stepsize Step sizes of za_grid and aa_grid
+
+  \return      The [za_grid.nelem(), aa_grid.nelem()] weights
+*/
+Matrix doit_scat_field_weights(ConstVectorView za_grid,
+                               ConstVectorView aa_grid,
+                               ConstVectorView grid_stepsize);
+
+//! The 1D scattering integral of one pressure level as a matrix product
+/*!
+  The phase matrices of the level are permuted into a [N_za * stokes_dim,
+  N_za * N_aa * stokes_dim] matrix, with rows by outgoing direction and
+  Stokes component and columns by incoming ones, and multiplied with the
+  weighted incoming radiation field.  This replaces the loops over
+  directions and Stokes components with one BLAS call per outgoing Stokes
+  component.
+
+  The buffers are resized if needed, so by reusing them for all levels
+  they are allocated once.
+
+  \param[out]   doit_scat_field Scattered field of the level [N_za, stokes_dim]
+  \param[in,out] pha_mat_level Buffer for the permuted phase matrices
+  \param[in,out] field_weighted Buffer for the weighted incoming field
+  \param[in]    pha_mat_doit Phase matrix field of a 1D atmosphere
+  \param[in]    p_index Pressure index in pha_mat_doit
+  \param[in]    cloudbox_field Incoming radiation field [N_za, stokes_dim]
+  \param[in]    weights See doit_scat_field_weights
+*/
+void doit_scat_field1D(MatrixView doit_scat_field,
+                       Matrix& pha_mat_level,
+                       Vector& field_weighted,
+                       const Tensor7& pha_mat_doit,
+                       const Index& p_index,
+                       ConstMatrixView cloudbox_field,
+                       ConstMatrixView weights);
+
 //! Optimize the zenith angle grid
 /*!
   This method optimizes the zenith angle grid. For optimization it uses the
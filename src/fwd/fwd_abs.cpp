@@ -1,14 +1,29 @@
 #include "fwd_abs.h"
 
 namespace fwd {
+catalog::catalog(const PredefinedModelData& predef,
+                 const ArrayOfCIARecord& cia,
+                 const ArrayOfXsecRecord& hxsec)
+    : predef_data(std::make_shared<const PredefinedModelData>(predef)) {
+  cia_data.reserve(cia.size());
+  for (const auto& x : cia) {
+    cia_data.push_back(std::make_shared<const CIARecord>(x));
+  }
+
+  hxsec_data.reserve(hxsec.size());
+  for (const auto& x : hxsec) {
+    hxsec_data.push_back(std::make_shared<const XsecRecord>(x));
+  }
+}
+
 full_absorption::full_absorption(
     Numeric p,
     Numeric t,
     const Vector& allvmrs,
     const ArrayOfArrayOfSpeciesTag& allspecs,
-    const std::shared_ptr<PredefinedModelData>& predef_data,
-    const std::vector<std::shared_ptr<CIARecord>>& cia_data,
-    const std::vector<std::shared_ptr<XsecRecord>>& hxsec_data,
+    const std::shared_ptr<const PredefinedModelData>& predef_data,
+    const std::vector<std::shared_ptr<const CIARecord>>& cia_data,
+    const std::vector<std::shared_ptr<const XsecRecord>>& hxsec_data,
     const SpeciesIsotopologueRatios& isotopologue_ratios,
     const ArrayOfArrayOfAbsorptionLines& lbl_data,
     Numeric cia_extrap,
@@ -19,16 +34,45 @@ full_absorption::full_absorption(
       lbl(t, p, isotopologue_ratios, allspecs, allvmrs, lbl_data),
       hxsec(p, t, allvmrs, allspecs, hxsec_data, verb) {}
 
+full_absorption::full_absorption(
+    Numeric p,
+    Numeric t,
+    const Vector& allvmrs,
+    const ArrayOfArrayOfSpeciesTag& allspecs,
+    const catalog& data,
+    const SpeciesIsotopologueRatios& isotopologue_ratios,
+    const ArrayOfArrayOfAbsorptionLines& lbl_data,
+    Numeric cia_extrap,
+    Index cia_robust,
+    Verbosity verb)
+    : full_absorption(p,
+                      t,
+                      allvmrs,
+                      allspecs,
+                      data.predef_data,
+                      data.cia_data,
+                      data.hxsec_data,
+                      isotopologue_ratios,
+                      lbl_data,
+                      cia_extrap,
+                      cia_robust,
+                      verb) {}
+
 Complex full_absorption::at(Numeric f) const {
   return cia.at(f) + predef.at(f) + lbl.at(f) + hxsec.at(f);
 }
 
 void full_absorption::at(ExhaustiveComplexVectorView abs,
                          const Vector& fs) const {
-  cia.at(abs, fs);
-  predef.at(abs, fs);
   lbl.at(abs, fs);
-  hxsec.at(abs, fs);
+
+  ComplexVector other(fs.size());
+  cia.at(other, fs);
+  abs += other;
+  predef.at(other, fs);
+  abs += other;
+  hxsec.at(other, fs);
+  abs += other;
 }
 
 ComplexVector full_absorption::at(const Vector& fs) const {
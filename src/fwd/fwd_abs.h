@@ -1,11 +1,33 @@
 #pragma once
 
+#include <memory>
+#include <vector>
+
 #include "fwd_cia.h"
 #include "fwd_hxsec.h"
 #include "fwd_lbl.h"
 #include "fwd_predef.h"
 
 namespace fwd {
+/** Spectroscopic data shared by the absorption models
+ *
+ * The records are copied once into reference-counted storage that is not
+ * changed after construction.  The levels of a profile keep pointers to the
+ * records they use, so many operators can be built from the same data without
+ * copying it again.
+ */
+struct catalog {
+  std::shared_ptr<const PredefinedModelData> predef_data{};
+  std::vector<std::shared_ptr<const CIARecord>> cia_data{};
+  std::vector<std::shared_ptr<const XsecRecord>> hxsec_data{};
+
+  catalog() = default;
+
+  catalog(const PredefinedModelData& predef,
+          const ArrayOfCIARecord& cia,
+          const ArrayOfXsecRecord& hxsec);
+};
+
 struct full_absorption {
   cia::full cia;
   predef::full predef;
@@ -18,9 +40,20 @@ struct full_absorption {
                   Numeric t,
                   const Vector& allvmrs,
                   const ArrayOfArrayOfSpeciesTag& allspecs,
-                  const std::shared_ptr<PredefinedModelData>& predef_data,
-                  const std::vector<std::shared_ptr<CIARecord>>& cia_data,
-                  const std::vector<std::shared_ptr<XsecRecord>>& hxsec_data,
+                  const std::shared_ptr<const PredefinedModelData>& predef_data,
+                  const std::vector<std::shared_ptr<const CIARecord>>& cia_data,
+                  const std::vector<std::shared_ptr<const XsecRecord>>& hxsec_data,
+                  const SpeciesIsotopologueRatios& isotopologue_ratios,
+                  const ArrayOfArrayOfAbsorptionLines& lbl_data,
+                  Numeric cia_extrap = {},
+                  Index cia_robust = {},
+                  Verbosity verb = {});
+
+  full_absorption(Numeric p,
+                  Numeric t,
+                  const Vector& allvmrs,
+                  const ArrayOfArrayOfSpeciesTag& allspecs,
+                  const catalog& data,
                   const SpeciesIsotopologueRatios& isotopologue_ratios,
                   const ArrayOfArrayOfAbsorptionLines& lbl_data,
                   Numeric cia_extrap = {},
@@ -7,31 +7,131 @@
 #include <functional>
 #include <numeric>
 
+#include "check_input.h"
 #include "debug.h"
+#include "interp.h"
 
 namespace fwd::cia {
+//! The frequency interpolation order of cia_interpolation()
+static constexpr Index f_order = 3;
+
+spectrum::spectrum(const GriddedField2& data,
+                   Numeric T,
+                   Numeric extrapol,
+                   Index robust)
+    : f_grid(data.get_numeric_grid(0)), cia(f_grid.size(), 0) {
+  if (f_grid.size() < f_order + 1) {
+    error = var_string("Not enough frequency grid points in CIA data.\n",
+                       "You have only ",
+                       f_grid.size(),
+                       " grid points.\n",
+                       "But need at least ",
+                       f_order + 1,
+                       ".");
+    return;
+  }
+
+  // For T we have to be adaptive, since sometimes there is only one T in
+  // the data
+  const ConstVectorView T_grid = data.get_numeric_grid(1);
+  const Index T_order = std::min<Index>(T_grid.size() - 1, 3);
+
+  if (T_order == 0) {
+    cia = data.data(joker, 0);
+    return;
+  }
+
+  try {
+    chk_interpolation_grids("Temperature interpolation for CIA continuum",
+                            T_grid,
+                            T,
+                            T_order,
+                            extrapol);
+  } catch (const std::runtime_error& e) {
+    if (robust) {
+      cia = NAN;
+    } else {
+      error = e.what();
+    }
+    return;
+  }
+
+  const LagrangeInterpolation T_lag(0, T, T_grid, T_order);
+  for (Index i = 0; i < f_grid.size(); i++) {
+    for (Index j = 0; j <= T_order; j++) {
+      cia[i] += T_lag.lx[j] * data.data(i, T_lag.pos + j);
+    }
+  }
+}
+
+Numeric spectrum::at(Numeric f) const {
+  if (f_grid.empty() or f < f_grid[0] or f > f_grid[f_grid.size() - 1]) return 0.0;
+  ARTS_USER_ERROR_IF(error.size(), error)
+
+  const auto p0 = std::distance(
+      f_grid.begin(), std::lower_bound(f_grid.begin(), f_grid.end(), f));
+  const FixedLagrangeInterpolation<f_order> lag(
+      std::max<Index>(p0 - 1, 0), f, f_grid, my_interp::AscendingOrder{});
+
+  Numeric out = 0.0;
+  for (Index j = 0; j <= f_order; j++) out += lag.lx[j] * cia[lag.pos + j];
+  return out < 0 ? 0.0 : out;
+}
+
+void spectrum::at(VectorView out, const Vector& fs) const {
+  ARTS_ASSERT(out.size() == fs.size())
+
+  out = 0;
+  if (f_grid.empty()) return;
+
+  // The position of the previous frequency is a good guess for sorted fs
+  Index pos = 0;
+  for (Index i = 0; i < fs.size(); i++) {
+    const Numeric f = fs[i];
+    if (f < f_grid[0] or f > f_grid[f_grid.size() - 1]) continue;
+    ARTS_USER_ERROR_IF(error.size(), error)
+
+    const FixedLagrangeInterpolation<f_order> lag(
+        pos, f, f_grid, my_interp::AscendingOrder{});
+    pos = lag.pos;
+
+    Numeric x = 0.0;
+    for (Index j = 0; j <= f_order; j++) x += lag.lx[j] * cia[pos + j];
+    out[i] = x < 0 ? 0.0 : x;
+  }
+}
+
 single::single(Numeric p,
                Numeric t,
                Numeric VMR1,
                Numeric VMR2,
-               const std::shared_ptr<CIARecord>& cia,
+               const std::shared_ptr<const CIARecord>& cia,
                Numeric extrap,
                Index robust,
-               Verbosity verb)
-    : scl(VMR1 * VMR2 * Math::pow2(number_density(p, t))),
-      T(t),
-      extrapol(extrap),
-      ignore_errors(robust),
-      verbosity(verb),
-      ciarecords(cia) {}
+               Verbosity)
+    : scl(VMR1 * VMR2 * Math::pow2(number_density(p, t))) {
+  spectra.reserve(cia->DatasetCount());
+  for (auto& data : cia->Data()) spectra.emplace_back(data, t, extrap, robust);
+}
 
 Complex single::at(Numeric f) const {
-  return scl * ciarecords->Extract(f, T, extrapol, ignore_errors, verbosity);
+  return scl * std::transform_reduce(spectra.begin(),
+                                     spectra.end(),
+                                     0.0,
+                                     std::plus<>{},
+                                     [f](auto& spec) { return spec.at(f); });
 }
 
 void single::at(ExhaustiveComplexVectorView abs, const Vector& fs) const {
-  std::transform(fs.begin(), fs.end(), abs.begin(), [this](const auto& f) {
-    return at(f);
+  Vector res(fs.size(), 0);
+  Vector result(fs.size());
+  for (auto& spec : spectra) {
+    spec.at(result, fs);
+    res += result;
+  }
+
+  std::transform(res.begin(), res.end(), abs.begin(), [this](Numeric x) {
+    return Complex{scl * x, 0.0};
   });
 }
 
@@ -45,7 +145,7 @@ full::full(Numeric p,
            Numeric t,
            const Vector& vmrs,
            const ArrayOfArrayOfSpeciesTag& allspecs,
-           const std::vector<std::shared_ptr<CIARecord>>& cia,
+           const std::vector<std::shared_ptr<const CIARecord>>& cia,
            Numeric extrap,
            Index robust,
            Verbosity verb) {
@@ -74,8 +174,13 @@ Complex full::at(Numeric f) const {
 }
 
 void full::at(ExhaustiveComplexVectorView abs, const Vector& fs) const {
+  abs = 0.0;
+  if (models.empty()) return;
+
+  ComplexVector model_abs(fs.size());
   for (auto& mod : models) {
-    mod.at(abs, fs);
+    mod.at(model_abs, fs);
+    abs += model_abs;
   }
 }
 
@@ -9,13 +9,29 @@
 #include "species_tags.h"
 
 namespace fwd::cia {
+//! A CIA dataset interpolated to a fixed temperature on its own frequency grid
+struct spectrum {
+  Vector f_grid{};
+  Vector cia{};
+
+  //! Non-empty if the temperature interpolation failed and errors are not ignored
+  String error{};
+
+  spectrum() = default;
+
+  spectrum(const GriddedField2& data,
+           Numeric T,
+           Numeric extrapol,
+           Index robust);
+
+  //! Cubic frequency interpolation of the spectrum, zero outside of f_grid
+  [[nodiscard]] Numeric at(Numeric f) const;
+  void at(VectorView out, const Vector& fs) const;
+};
+
 struct single {
   Numeric scl{};
-  Numeric T;
-  Numeric extrapol;
-  Index ignore_errors;
-  Verbosity verbosity;
-  std::shared_ptr<CIARecord> ciarecords{};
+  std::vector<spectrum> spectra{};
 
   single() = default;
 
@@ -23,7 +39,7 @@ struct single {
          Numeric t,
          Numeric VMR1,
          Numeric VMR2,
-         const std::shared_ptr<CIARecord>& cia,
+         const std::shared_ptr<const CIARecord>& cia,
          Numeric extrap = {},
          Index robust = {},
          Verbosity verb = {});
@@ -42,7 +58,7 @@ struct full {
        Numeric t,
        const Vector& vmrs,
        const ArrayOfArrayOfSpeciesTag& allspecs,
-       const std::vector<std::shared_ptr<CIARecord>>& cia,
+       const std::vector<std::shared_ptr<const CIARecord>>& cia,
        Numeric extrap = {},
        Index robust = {},
        Verbosity verb = {});
@@ -2,27 +2,77 @@
 
 #include "physics_funcs.h"
 
+#include <algorithm>
+#include <iterator>
+
 namespace fwd::hxsec {
+spectrum::spectrum(const XsecRecord& data, Index dataset, Numeric p, Numeric t)
+    : f_grid(data.FitCoeffs()[dataset].get_numeric_grid(0)),
+      xsec(data.Spectrum(dataset, p, t)) {}
+
+Numeric spectrum::at(Numeric f) const {
+  const Index n = f_grid.size();
+  if (n == 0 or f < f_grid[0] or f > f_grid[n - 1]) return 0.0;
+
+  // A single point, f is exactly on it
+  if (n == 1) return xsec[0];
+
+  const Index i = std::clamp<Index>(
+      std::distance(f_grid.begin(),
+                    std::upper_bound(f_grid.begin(), f_grid.end(), f)) -
+          1,
+      0,
+      n - 2);
+  const Numeric x = (f - f_grid[i]) / (f_grid[i + 1] - f_grid[i]);
+  return (1.0 - x) * xsec[i] + x * xsec[i + 1];
+}
+
+void spectrum::add(VectorView out, const Vector& fs) const {
+  ARTS_ASSERT(out.size() == fs.size())
+
+  const Index n = f_grid.size();
+  if (n < 2 or not std::is_sorted(fs.begin(), fs.end())) {
+    for (Index i = 0; i < fs.size(); i++) out[i] += at(fs[i]);
+    return;
+  }
+
+  // Only the part of fs inside the dataset, with the grid position advancing
+  const auto first = std::lower_bound(fs.begin(), fs.end(), f_grid[0]);
+  const auto last = std::upper_bound(first, fs.end(), f_grid[n - 1]);
+  Index j = 0;
+  for (Index i = std::distance(fs.begin(), first);
+       i < std::distance(fs.begin(), last);
+       i++) {
+    const Numeric f = fs[i];
+    while (j < n - 2 and f_grid[j + 1] < f) j++;
+    const Numeric x = (f - f_grid[j]) / (f_grid[j + 1] - f_grid[j]);
+    out[i] += (1.0 - x) * xsec[j] + x * xsec[j + 1];
+  }
+}
+
 single::single(Numeric p,
                Numeric t,
                Numeric VMR,
-               const std::shared_ptr<XsecRecord>& cia,
-               Verbosity verb)
-    : scl{number_density(p, t) * VMR},
-      P{p},
-      T{t},
-      verbosity{verb},
-      xsecrec{cia} {}
+               const std::shared_ptr<const XsecRecord>& cia,
+               Verbosity)
+    : scl{number_density(p, t) * VMR} {
+  const Index n = cia->FitCoeffs().size();
+  spectra.reserve(n);
+  for (Index i = 0; i < n; i++) spectra.emplace_back(*cia, i, p, t);
+}
 
 Complex single::at(Numeric f) const {
   Numeric out{};
-  xsecrec->Extract(ExhaustiveVectorView{out}, Vector{f}, P, T, verbosity);
+  for (auto& spec : spectra) out += spec.at(f);
   return scl * out;
 }
 
 void single::at(ExhaustiveComplexVectorView abs, const Vector& fs) const {
-  std::transform(fs.begin(), fs.end(), abs.begin(), [this](const auto& f) {
-    return at(f);
+  Vector out(fs.size(), 0);
+  for (auto& spec : spectra) spec.add(out, fs);
+
+  std::transform(out.begin(), out.end(), abs.begin(), [this](Numeric x) {
+    return Complex{scl * x, 0.0};
   });
 }
 
@@ -36,7 +86,7 @@ full::full(Numeric p,
        Numeric t,
        const Vector& vmrs,
        const ArrayOfArrayOfSpeciesTag& allspecs,
-       const std::vector<std::shared_ptr<XsecRecord>>& xsec,
+       const std::vector<std::shared_ptr<const XsecRecord>>& xsec,
        Verbosity verb) {
   for (auto& specs : allspecs) {
     for (auto& spec : specs) {
@@ -61,8 +111,13 @@ Complex full::at(Numeric f) const {
 }
 
 void full::at(ExhaustiveComplexVectorView abs, const Vector& fs) const {
+  abs = 0.0;
+  if (models.empty()) return;
+
+  ComplexVector model_abs(fs.size());
   for (auto& mod : models) {
-    mod.at(abs, fs);
+    mod.at(model_abs, fs);
+    abs += model_abs;
   }
 }
 
@@ -1,24 +1,38 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 
 #include "../species_tags.h"
 #include "../xsec_fit.h"
 
 namespace fwd::hxsec {
+//! A fitted cross section dataset evaluated at fixed pressure and temperature
+struct spectrum {
+  Vector f_grid{};
+  Vector xsec{};
+
+  spectrum() = default;
+
+  spectrum(const XsecRecord& data, Index dataset, Numeric p, Numeric t);
+
+  //! Linear frequency interpolation of the spectrum, zero outside of f_grid
+  [[nodiscard]] Numeric at(Numeric f) const;
+
+  //! Adds the spectrum interpolated to fs to out
+  void add(VectorView out, const Vector& fs) const;
+};
+
 struct single {
   Numeric scl{};
-  Numeric P{};
-  Numeric T{};
-  Verbosity verbosity{};
-  std::shared_ptr<XsecRecord> xsecrec{};
+  std::vector<spectrum> spectra{};
 
   single() = default;
   
   single(Numeric p,
          Numeric t,
          Numeric VMR,
-         const std::shared_ptr<XsecRecord>& cia,
+         const std::shared_ptr<const XsecRecord>& cia,
          Verbosity verb = {});
 
   [[nodiscard]] Complex at(Numeric f) const;
@@ -35,7 +49,7 @@ struct full {
        Numeric t,
        const Vector& vmrs,
        const ArrayOfArrayOfSpeciesTag& allspecs,
-       const std::vector<std::shared_ptr<XsecRecord>>& xsec,
+       const std::vector<std::shared_ptr<const XsecRecord>>& xsec,
        Verbosity verb = {});
 
   [[nodiscard]] Complex at(Numeric f) const;
@@ -35,6 +35,29 @@ irradiance::irradiance(const Vector& z,
           cia_robust,
           verb) {}
 
+irradiance::irradiance(const Vector& z,
+                       const Vector& p,
+                       const Vector& t,
+                       const std::vector<Vector>& allvmrs,
+                       const ArrayOfArrayOfSpeciesTag& allspecs,
+                       std::shared_ptr<const catalog> catalog_data,
+                       const SpeciesIsotopologueRatios& isotopologue_ratios,
+                       const ArrayOfArrayOfAbsorptionLines& lbl_data,
+                       Numeric cia_extrap,
+                       Index cia_robust,
+                       Verbosity verb)
+    : rad(z,
+          p,
+          t,
+          allvmrs,
+          allspecs,
+          std::move(catalog_data),
+          isotopologue_ratios,
+          lbl_data,
+          cia_extrap,
+          cia_robust,
+          verb) {}
+
 void irradiance::planar(ExhaustiveVectorView irr,
                         Numeric f,
                         const Index streams) const {
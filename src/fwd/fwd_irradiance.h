@@ -23,7 +23,19 @@ struct irradiance {
              Numeric cia_extrap = {},
              Index cia_robust = {},
              Verbosity verb = {});
-  
+
+  irradiance(const Vector& z,
+             const Vector& p,
+             const Vector& t,
+             const std::vector<Vector>& allvmrs,
+             const ArrayOfArrayOfSpeciesTag& allspecs,
+             std::shared_ptr<const catalog> catalog_data,
+             const SpeciesIsotopologueRatios& isotopologue_ratios,
+             const ArrayOfArrayOfAbsorptionLines& lbl_data,
+             Numeric cia_extrap = {},
+             Index cia_robust = {},
+             Verbosity verb = {});
+
   irradiance(spectral_radiance  fwd_rad) : rad(std::move(fwd_rad)) {}
 
   //! FIXME: Will change in arts-3
@@ -78,9 +78,14 @@ ComplexVector fwd::lbl::full::at(const Vector& f) const {
 
 void fwd::lbl::full::at(ExhaustiveComplexVectorView out,
                         const Vector& fs) const {
-  std::transform(fs.begin(), fs.end(), out.begin(), [this](const auto& f) {
-    return at(f);
-  });
+  out = 0.0;
+  if (models.empty()) return;
+
+  ComplexVector model_out(fs.size());
+  for (auto& m : models) {
+    std::visit([&](auto& mod) { mod.at(model_out, fs); }, m);
+    out += model_out;
+  }
 }
 
 ComplexVector fwd::lbl::full::at_par(const Vector& f) const {
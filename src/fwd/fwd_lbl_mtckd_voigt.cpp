@@ -1,7 +1,9 @@
 #include "fwd_lbl_mtckd_voigt.h"
 #include "fwd_lbl_algorithms.h"
+#include "fwd_lbl_faddeeva.h"
 
 #include <algorithm>
+#include <array>
 #include <iterator>
 #include <numeric>
 
@@ -101,6 +103,106 @@ bool single_lm::is_valid(const AbsorptionLines& band) {
          band.AnyLinemixing();
 }
 
+lines_soa::lines_soa(const std::vector<single>& lines) {
+  const std::size_t n = lines.size();
+  for (auto* v : {&F0, &invGD, &z_imag, &scl_re, &scl_im, &cutlow_re,
+                  &cutlow_im, &cutupp_re, &cutupp_im}) {
+    v->reserve(n);
+  }
+
+  for (auto& line : lines) {
+    F0.push_back(line.F0);
+    invGD.push_back(line.invGD);
+    z_imag.push_back(line.z_imag);
+    scl_re.push_back(line.scl);
+    scl_im.push_back(0.0);
+    cutlow_re.push_back(line.cutoff.real());
+    cutlow_im.push_back(line.cutoff.imag());
+    cutupp_re.push_back(line.cutoff.real());
+    cutupp_im.push_back(line.cutoff.imag());
+  }
+}
+
+lines_soa::lines_soa(const std::vector<single_lm>& lines) {
+  const std::size_t n = lines.size();
+  for (auto* v : {&F0, &invGD, &z_imag, &scl_re, &scl_im, &cutlow_re,
+                  &cutlow_im, &cutupp_re, &cutupp_im}) {
+    v->reserve(n);
+  }
+
+  for (auto& line : lines) {
+    F0.push_back(line.F0);
+    invGD.push_back(line.invGD);
+    z_imag.push_back(line.z_imag);
+    scl_re.push_back(line.scl.real());
+    scl_im.push_back(line.scl.imag());
+    cutlow_re.push_back(line.cutlow.real());
+    cutlow_im.push_back(line.cutlow.imag());
+    cutupp_re.push_back(line.cutupp.real());
+    cutupp_im.push_back(line.cutupp.imag());
+  }
+}
+
+void lines_soa::sumup(ExhaustiveComplexVectorView sum, const Vector& fs) const {
+  ARTS_ASSERT(sum.size() == fs.size())
+
+  constexpr Numeric inv_2fc = 1.0 / (2.0 * cutoff_freq);
+  const Index n = fs.size();
+
+  // For an increasing grid, the line window [first, last) only ever moves
+  // forward, so it is advanced from the previous block instead of searched
+  const bool sorted = std::is_sorted(fs.begin(), fs.end());
+  auto first = F0.begin();
+  auto last = F0.begin();
+
+  std::array<Numeric, block_size> f;
+  std::array<Numeric, block_size> re;
+  std::array<Numeric, block_size> im;
+  for (Index i0 = 0; i0 < n; i0 += block_size) {
+    const Index nb = std::min(block_size, n - i0);
+    std::copy(fs.begin() + i0, fs.begin() + i0 + nb, f.begin());
+    re.fill(0.0);
+    im.fill(0.0);
+
+    if (sorted) {
+      while (first != F0.end() and *first < f[0] - cutoff_freq) ++first;
+      last = std::max(first, last);
+      while (last != F0.end() and *last <= f[nb - 1] + cutoff_freq) ++last;
+    } else {
+      const auto [fmin, fmax] = std::minmax_element(f.begin(), f.begin() + nb);
+      first = std::lower_bound(F0.begin(), F0.end(), *fmin - cutoff_freq);
+      last = std::upper_bound(first, F0.end(), *fmax + cutoff_freq);
+    }
+
+    for (auto k = std::distance(F0.begin(), first),
+              kend = std::distance(F0.begin(), last);
+         k < kend;
+         k++) {
+      const Numeric F0_k = F0[k];
+      const Numeric invGD_k = invGD[k];
+      const Numeric z_imag_k = z_imag[k];
+      const Numeric sr = scl_re[k];
+      const Numeric si = scl_im[k];
+      const Numeric clr = cutlow_re[k];
+      const Numeric cli = cutlow_im[k];
+      const Numeric dcr = cutupp_re[k] - clr;
+      const Numeric dci = cutupp_im[k] - cli;
+
+#pragma omp simd
+      for (Index j = 0; j < nb; j++) {
+        const Numeric df = f[j] - F0_k;
+        const Complex w = faddeeva::w(invGD_k * df, z_imag_k);
+        const Numeric t = std::clamp(0.5 + df * inv_2fc, 0.0, 1.0);
+        const bool inside = std::abs(df) <= cutoff_freq;
+        re[j] += inside ? sr * w.real() - si * w.imag() - (clr + t * dcr) : 0.0;
+        im[j] += inside ? sr * w.imag() + si * w.real() - (cli + t * dci) : 0.0;
+      }
+    }
+
+    for (Index j = 0; j < nb; j++) sum[i0 + j] += Complex{re[j], im[j]};
+  }
+}
+
 std::size_t band::validity_count(
     const ArrayOfArrayOfAbsorptionLines& specbands) {
   std::size_t n = 0;
@@ -118,23 +220,29 @@ band::band(Numeric t,
            const ArrayOfArrayOfSpeciesTag& allspecs,
            const Vector& allvmrs,
            const ArrayOfArrayOfAbsorptionLines& specbands)
-    : T(t), P(p) {
-  lines.reserve(validity_count(specbands));
-
-  for (auto& bs : specbands) {
-    for (auto& b : bs) {
-      if (single::is_valid(b)) {
-        for (std::size_t line = 0; line < b.lines.size(); ++line) {
-          lines.emplace_back(
-              t, P, isotopologue_ratios, allspecs, allvmrs, b, line);
+    : band(t, p, [&]() {
+        std::vector<single> lines;
+        lines.reserve(validity_count(specbands));
+        for (auto& bs : specbands) {
+          for (auto& b : bs) {
+            if (single::is_valid(b)) {
+              for (std::size_t line = 0; line < b.lines.size(); ++line) {
+                lines.emplace_back(
+                    t, p, isotopologue_ratios, allspecs, allvmrs, b, line);
+              }
+            }
+          }
         }
-      }
-    }
-  }
+        return lines;
+      }()) {}
 
-  std::sort(lines.begin(), lines.end(), [](const auto& l1, const auto& l2) {
+band::band(Numeric t, Numeric p, std::vector<single> lines)
+    : T(t), P(p), aos(std::move(lines)) {
+  std::sort(aos.begin(), aos.end(), [](const auto& l1, const auto& l2) {
     return l1.F0 < l2.F0;
   });
+
+  soa = lines_soa(aos);
 }
 
 Complex band::at(Numeric f) const {
@@ -144,14 +252,27 @@ Complex band::at(Numeric f) const {
   const Numeric fscl = -f * std::expm1(-hz2joule(f) / kelvin2joule(T));
   const Numeric nscl = number_density(P, T);
 
-  const Complex sum = sumup(lines, f, cutoff_freq);
+  const Complex sum = sumup(aos, f, cutoff_freq);
   return sum.real() < 0 ? Complex{0, 0} : sum * fscl * nscl;
 }
 
 void band::at(ExhaustiveComplexVectorView out, const Vector& fs) const {
-  std::transform(fs.begin(), fs.end(), out.begin(), [this](const auto& f) {
-    return at(f);
-  });
+  using Conversion::hz2joule;
+  using Conversion::kelvin2joule;
+
+  const Numeric nscl = number_density(P, T);
+
+  out = 0.0;
+  soa.sumup(out, fs);
+  std::transform(
+      fs.begin(),
+      fs.end(),
+      out.begin(),
+      out.begin(),
+      [this, nscl](const Numeric f, const Complex sum) {
+        const Numeric fscl = -f * std::expm1(-hz2joule(f) / kelvin2joule(T));
+        return sum.real() < 0 ? Complex{0, 0} : sum * fscl * nscl;
+      });
 }
 
 ComplexVector band::at(const Vector& f) const {
@@ -175,8 +296,8 @@ std::size_t band_lm::validity_count(
 }
 
 std::size_t band_lm::size() const {
-  return std::transform_reduce(bands.begin(),
-                               bands.end(),
+  return std::transform_reduce(aos.begin(),
+                               aos.end(),
                                std::size_t{},
                                std::plus<>{},
                                [](const auto& b) { return b.size(); });
@@ -188,25 +309,34 @@ band_lm::band_lm(Numeric t,
                  const ArrayOfArrayOfSpeciesTag& allspecs,
                  const Vector& allvmrs,
                  const ArrayOfArrayOfAbsorptionLines& specbands)
-    : T(t), P(p) {
-  bands.reserve(validity_count(specbands));
-  for (auto& bs : specbands) {
-    for (auto& b : bs) {
-      if (single_lm::is_valid(b)) {
-        bands.emplace_back();
-        bands.back().reserve(b.lines.size());
-        for (std::size_t line = 0; line < b.lines.size(); ++line) {
-          bands.back().emplace_back(
-              t, P, isotopologue_ratios, allspecs, allvmrs, b, line);
+    : band_lm(t, p, [&]() {
+        std::vector<std::vector<single_lm>> bands;
+        bands.reserve(validity_count(specbands));
+        for (auto& bs : specbands) {
+          for (auto& b : bs) {
+            if (single_lm::is_valid(b)) {
+              bands.emplace_back();
+              bands.back().reserve(b.lines.size());
+              for (std::size_t line = 0; line < b.lines.size(); ++line) {
+                bands.back().emplace_back(
+                    t, p, isotopologue_ratios, allspecs, allvmrs, b, line);
+              }
+            }
+          }
         }
-      }
-    }
-  }
+        return bands;
+      }()) {}
 
-  for (auto& lines : bands) {
+band_lm::band_lm(Numeric t,
+                 Numeric p,
+                 std::vector<std::vector<single_lm>> bands)
+    : T(t), P(p), aos(std::move(bands)) {
+  soas.reserve(aos.size());
+  for (auto& lines : aos) {
     std::sort(lines.begin(), lines.end(), [](const auto& l1, const auto& l2) {
       return l1.F0 < l2.F0;
     });
+    soas.emplace_back(lines);
   }
 }
 
@@ -223,15 +353,40 @@ Complex band_lm::at(Numeric f) const {
   };
 
   const auto sum = std::transform_reduce(
-      bands.begin(), bands.end(), Complex{0, 0}, std::plus<>{}, allsum);
+      aos.begin(), aos.end(), Complex{0, 0}, std::plus<>{}, allsum);
 
   return fscl * nscl * sum;
 }
 
 void band_lm::at(ExhaustiveComplexVectorView out, const Vector& fs) const {
-  std::transform(fs.begin(), fs.end(), out.begin(), [this](const auto& f) {
-    return at(f);
-  });
+  using Conversion::hz2joule;
+  using Conversion::kelvin2joule;
+
+  const Numeric nscl = number_density(P, T);
+
+  out = 0.0;
+  ComplexVector sum(fs.size());
+  for (auto& soa : soas) {
+    sum = 0.0;
+    soa.sumup(sum, fs);
+    std::transform(sum.begin(),
+                   sum.end(),
+                   out.begin(),
+                   out.begin(),
+                   [](const Complex s, const Complex o) {
+                     return s.real() < 0 ? o : o + s;
+                   });
+  }
+
+  std::transform(
+      fs.begin(),
+      fs.end(),
+      out.begin(),
+      out.begin(),
+      [this, nscl](const Numeric f, const Complex s) {
+        const Numeric fscl = -f * std::expm1(-hz2joule(f) / kelvin2joule(T));
+        return fscl * nscl * s;
+      });
 }
 
 ComplexVector band_lm::at(const Vector& f) const {
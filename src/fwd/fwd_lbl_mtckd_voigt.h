@@ -22,6 +22,8 @@ struct single {
   Numeric z_imag{};
   Complex cutoff{};
 
+  single() = default;
+
   single(Numeric T,
          Numeric P,
          const SpeciesIsotopologueRatios& isotopologue_ratios,
@@ -51,6 +53,8 @@ struct single_lm {
   Complex cutupp{};
   Complex cutlow{};
 
+  single_lm() = default;
+
   single_lm(Numeric T,
             Numeric P,
             const SpeciesIsotopologueRatios& isotopologue_ratios,
@@ -78,8 +82,54 @@ struct single_lm {
   [[nodiscard]] static bool is_valid(const AbsorptionLines& band);
 };
 
+/** Structure-of-arrays copy of a list of lines sorted by F0
+ *
+ * Holds the same data as std::vector<single> or std::vector<single_lm> but
+ * as contiguous arrays, so that many lines can be evaluated against a block
+ * of frequencies with vectorized code.  A single line is stored as a line
+ * with zero line mixing and a constant cutoff.
+ */
+struct lines_soa {
+  std::vector<Numeric> F0{};
+  std::vector<Numeric> invGD{};
+  std::vector<Numeric> z_imag{};
+  std::vector<Numeric> scl_re{};
+  std::vector<Numeric> scl_im{};
+  std::vector<Numeric> cutlow_re{};
+  std::vector<Numeric> cutlow_im{};
+  std::vector<Numeric> cutupp_re{};
+  std::vector<Numeric> cutupp_im{};
+
+  //! Number of frequencies evaluated together in sumup()
+  static constexpr Index block_size = 64;
+
+  lines_soa() = default;
+  explicit lines_soa(const std::vector<single>& lines);
+  explicit lines_soa(const std::vector<single_lm>& lines);
+
+  [[nodiscard]] std::size_t size() const { return F0.size(); }
+
+  /** Adds the contribution of all lines within cutoff_freq to sum
+   *
+   * Works on blocks of block_size frequencies, only looping over the
+   * lines that are within the cutoff of some frequency in the block.
+   * For an increasing frequency grid, the window of lines is moved along
+   * with the blocks, so the cost per frequency only depends on the number
+   * of lines within the cutoff.  Other grids are allowed, but each block
+   * then has to search for its window.
+   *
+   * @param[inout] sum The sum of lines, same size as fs
+   * @param[in] fs The frequency grid
+   */
+  void sumup(ExhaustiveComplexVectorView sum, const Vector& fs) const;
+};
+
+/** A band of lines without line mixing
+ *
+ * The lines are only set by the constructors, which sort them by F0 and
+ * derive the structure-of-arrays copy from them, so both always agree.
+ */
 struct band {
-  std::vector<single> lines;
   Numeric T;
   Numeric P;
 
@@ -92,17 +142,27 @@ struct band {
        const Vector& allvmrs,
        const ArrayOfArrayOfAbsorptionLines& specbands);
 
+  band(Numeric T, Numeric P, std::vector<single> lines);
+
   [[nodiscard]] static std::size_t validity_count(
       const ArrayOfArrayOfAbsorptionLines& band);
-  [[nodiscard]] std::size_t size() const { return lines.size(); }
+  [[nodiscard]] std::size_t size() const { return aos.size(); }
+  [[nodiscard]] const std::vector<single>& lines() const { return aos; }
 
   [[nodiscard]] Complex at(Numeric f) const;
   void at(ExhaustiveComplexVectorView out, const Vector& fs) const;
   [[nodiscard]] ComplexVector at(const Vector& fs) const;
+
+ private:
+  std::vector<single> aos;
+  lines_soa soa;
 };
 
+/** Bands of lines with line mixing, the cutoff is applied per band
+ *
+ * As for band, the lines of each band are only set by the constructors.
+ */
 struct band_lm {
-  std::vector<std::vector<single_lm>> bands;
   Numeric T;
   Numeric P;
 
@@ -115,12 +175,21 @@ struct band_lm {
           const Vector& allvmrs,
           const ArrayOfArrayOfAbsorptionLines& specbands);
 
+  band_lm(Numeric T, Numeric P, std::vector<std::vector<single_lm>> bands);
+
   [[nodiscard]] static std::size_t validity_count(
       const ArrayOfArrayOfAbsorptionLines& band);
   [[nodiscard]] std::size_t size() const;
+  [[nodiscard]] const std::vector<std::vector<single_lm>>& bands() const {
+    return aos;
+  }
 
   [[nodiscard]] Complex at(Numeric f) const;
   void at(ExhaustiveComplexVectorView out, const Vector& fs) const;
   [[nodiscard]] ComplexVector at(const Vector& fs) const;
+
+ private:
+  std::vector<std::vector<single_lm>> aos;
+  std::vector<lines_soa> soas;
 };
 }  // namespace fwd::lbl::mtckd
@@ -10,7 +10,7 @@ full::full(Numeric p,
            Numeric t,
            const Vector& allvmrs,
            const ArrayOfArrayOfSpeciesTag& allspecs,
-           const std::shared_ptr<PredefinedModelData>& data)
+           const std::shared_ptr<const PredefinedModelData>& data)
     : P(p),
       T(t),
       vmrs(Absorption::PredefinedModel::VMRS(allspecs, allvmrs)),
@@ -11,7 +11,7 @@ struct full {
   Numeric P;
   Numeric T;
   Absorption::PredefinedModel::VMRS vmrs;
-  std::shared_ptr<PredefinedModelData> predefined_model_data;
+  std::shared_ptr<const PredefinedModelData> predefined_model_data;
 
   full() = default;
 
@@ -19,7 +19,7 @@ struct full {
        Numeric t,
        const Vector& allvmrs,
        const ArrayOfArrayOfSpeciesTag& allspecs,
-       const std::shared_ptr<PredefinedModelData>& data);
+       const std::shared_ptr<const PredefinedModelData>& data);
 
   [[nodiscard]] Complex at(Numeric f) const;
   void at(ExhaustiveComplexVectorView abs, const Vector& fs) const;
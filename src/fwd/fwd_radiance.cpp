@@ -2,12 +2,15 @@
 
 #include <predefined/predef_data.h>
 
+#include <algorithm>
 #include <cstddef>
 #include <exception>
 #include <memory>
 #include <stdexcept>
+#include <utility>
 
 #include "arts_constants.h"
+#include "arts_omp.h"
 #include "arts_conversions.h"
 #include "cia.h"
 #include "debug.h"
@@ -29,25 +32,35 @@ spectral_radiance::spectral_radiance(
     Numeric cia_extrap,
     Index cia_robust,
     Verbosity verb)
-    : refl(0), altitude(z.begin(), z.end()), temperature(t.begin(), t.end()) {
-  const std::vector<std::shared_ptr<CIARecord>> cia_records = [&]() {
-    std::vector<std::shared_ptr<CIARecord>> ciar;
-    ciar.reserve(cia_data.size());
-    for (const auto& cia : cia_data) {
-      ciar.push_back(std::make_shared<CIARecord>(cia));
-    }
-    return ciar;
-  }();
-  const std::vector<std::shared_ptr<XsecRecord>> xsec_records = [&]() {
-    std::vector<std::shared_ptr<XsecRecord>> xsecr;
-    xsecr.reserve(cia_data.size());
-    for (const auto& xsec : xsec_data) {
-      xsecr.push_back(std::make_shared<XsecRecord>(xsec));
-    }
-    return xsecr;
-  }();
-  const std::shared_ptr<PredefinedModelData> predef_model_data =
-      std::make_shared<PredefinedModelData>(predef_data);
+    : spectral_radiance(
+          z,
+          p,
+          t,
+          allvmrs,
+          allspecs,
+          std::make_shared<const catalog>(predef_data, cia_data, xsec_data),
+          isotopologue_ratios,
+          lbl_data,
+          cia_extrap,
+          cia_robust,
+          verb) {}
+
+spectral_radiance::spectral_radiance(
+    const Vector& z,
+    const Vector& p,
+    const Vector& t,
+    const std::vector<Vector>& allvmrs,
+    const ArrayOfArrayOfSpeciesTag& allspecs,
+    std::shared_ptr<const catalog> catalog_data,
+    const SpeciesIsotopologueRatios& isotopologue_ratios,
+    const ArrayOfArrayOfAbsorptionLines& lbl_data,
+    Numeric cia_extrap,
+    Index cia_robust,
+    Verbosity verb)
+    : refl(0),
+      altitude(z.begin(), z.end()),
+      temperature(t.begin(), t.end()) {
+  ARTS_USER_ERROR_IF(not catalog_data, "Must have a spectroscopic data catalog")
 
   const std::size_t n = altitude.size();
   const std::size_t m = allspecs.size();
@@ -92,9 +105,7 @@ spectral_radiance::spectral_radiance(
                                   t[i],
                                   allvmrs[i],
                                   allspecs,
-                                  predef_model_data,
-                                  cia_records,
-                                  xsec_records,
+                                  *catalog_data,
                                   isotopologue_ratios,
                                   lbl_data,
                                   cia_extrap,
@@ -179,15 +190,124 @@ Vector spectral_radiance::planar(Numeric f, Numeric za) const {
   return rad;
 }
 
+void spectral_radiance::planar_block(MatrixView rad,
+                                     const Vector& fs,
+                                     const ConstComplexMatrixView& abs,
+                                     Numeric za) const {
+  using Conversion::cosd;
+  using std::exp;
+  using std::lerp;
+  using std::midpoint;
+  constexpr Numeric Tcmb = Constant::cosmic_microwave_background_temperature;
+
+  const Index n = static_cast<Index>(altitude.size());
+  const Index nf = fs.size();
+  ARTS_USER_ERROR_IF(rad.nrows() not_eq nf or rad.ncols() not_eq n,
+                     "Bad size radiance input matrix view\n")
+  ARTS_USER_ERROR_IF(abs.nrows() not_eq n or abs.ncols() not_eq nf,
+                     "Bad size absorption input matrix view\n")
+  ARTS_USER_ERROR_IF(
+      za == 90.0,
+      "You cannot look sideways in a plane-parallel atmosphere.\n"
+      "The zenith angle must be above or below 1 degree of the limb.\n")
+
+  const Numeric z_scl = 1.0 / std::abs(cosd(za));
+
+  // Level-major so that the recurrence runs over contiguous frequencies
+  Matrix I(n, nf);
+  Vector B_past(nf), B_this(nf);
+
+  const auto step = [&](Index i, Index i_past) {
+    const Numeric dz = z_scl * std::abs(altitude[i] - altitude[i_past]);
+    for (Index j = 0; j < nf; j++) B_this[j] = planck(fs[j], temperature[i]);
+
+#pragma omp simd
+    for (Index j = 0; j < nf; j++) {
+      const Numeric B = midpoint(B_past[j], B_this[j]);
+      const Numeric T =
+          exp(-dz * midpoint(abs(i, j).real(), abs(i_past, j).real()));
+      I(i, j) = lerp(B, I(i_past, j), T);
+    }
+
+    std::swap(B_past, B_this);
+  };
+
+  const bool looking_down = za > 90;
+  if (looking_down) {
+    for (Index j = 0; j < nf; j++) {
+      B_past[j] = planck(fs[j], temperature.front());
+    }
+
+    Matrix up;
+    if (refl not_eq 0.0) {
+      up.resize(nf, n);
+      planar_block(up, fs, abs, 180 - za);
+    }
+
+    for (Index j = 0; j < nf; j++) {
+      const Numeric Bbg = refl == 1.0 ? 0.0 : B_past[j];
+      const Numeric Ibg = refl == 0.0 ? 0.0 : up(j, 0);
+      I(0, j) = lerp(Bbg, Ibg, refl);
+    }
+
+    for (Index i = 1; i < n; ++i) step(i, i - 1);
+  } else {
+    for (Index j = 0; j < nf; j++) {
+      I(n - 1, j) = planck(fs[j], Tcmb);
+      B_past[j] = planck(fs[j], temperature.back());
+    }
+
+    for (Index i = n - 2; i >= 0; --i) step(i, i + 1);
+  }
+
+  for (Index j = 0; j < nf; j++) {
+    for (Index i = 0; i < n; i++) rad(j, i) = I(i, j);
+  }
+}
+
 void spectral_radiance::planar_par(ExhaustiveMatrixView rad,
                                    const Vector& fs,
                                    Numeric za) const {
-  const Index n = fs.size();
+  const Index n = static_cast<Index>(altitude.size());
+  const Index nf = fs.size();
+  ARTS_USER_ERROR_IF(rad.nrows() not_eq nf or rad.ncols() not_eq n,
+                     "Bad size radiance input matrix view\n")
 
-#pragma omp parallel for
-  for (Index i = 0; i < n; i++) {
-    planar(rad[i], fs[i], za);
+  const Index nblocks = (nf + planar_block_size - 1) / planar_block_size;
+  const bool parallel_blocks = nblocks >= arts_omp_get_max_threads();
+
+  String error_msg;
+#pragma omp parallel for if (parallel_blocks) schedule(dynamic)
+  for (Index iblock = 0; iblock < nblocks; iblock++) {
+    if (error_msg.size()) continue;
+
+    const Range range(iblock * planar_block_size,
+                      std::min(planar_block_size,
+                               nf - iblock * planar_block_size));
+    const Vector f{fs[range]};
+    ComplexMatrix abs(n, f.size());
+
+#pragma omp parallel for if (not parallel_blocks)
+    for (Index i = 0; i < n; i++) {
+      if (error_msg.size()) continue;
+      try {
+        models[i].at(abs[i], f);
+      } catch (std::exception& e) {
+#pragma omp critical
+        if (error_msg.size() == 0) error_msg = e.what();
+      }
+    }
+
+    if (error_msg.size()) continue;
+    try {
+      planar_block(rad(range, joker), f, abs, za);
+    } catch (std::exception& e) {
+#pragma omp critical
+      if (error_msg.size() == 0) error_msg = e.what();
+    }
   }
+
+  ARTS_USER_ERROR_IF(error_msg.size(), "Input: za=", za, '\n', error_msg)
 }
 
 Matrix spectral_radiance::planar_par(const Vector& fs, Numeric za) const {
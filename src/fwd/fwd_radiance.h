@@ -1,5 +1,6 @@
 #pragma once
 
+#include <memory>
 #include <ostream>
 
 #include "fwd_abs.h"
@@ -27,6 +28,19 @@ struct spectral_radiance {
                     Index cia_robust = {},
                     Verbosity verb = {});
 
+  //! As above but sharing the spectroscopic data with other operators
+  spectral_radiance(const Vector& z,
+                    const Vector& p,
+                    const Vector& t,
+                    const std::vector<Vector>& allvmrs,
+                    const ArrayOfArrayOfSpeciesTag& allspecs,
+                    std::shared_ptr<const catalog> catalog_data,
+                    const SpeciesIsotopologueRatios& isotopologue_ratios,
+                    const ArrayOfArrayOfAbsorptionLines& lbl_data,
+                    Numeric cia_extrap = {},
+                    Index cia_robust = {},
+                    Verbosity verb = {});
+
   //! FIXME: Will change in arts-3
   [[nodiscard]] Vector planar(Numeric f, Numeric za) const;
 
@@ -35,7 +49,33 @@ struct spectral_radiance {
                               Numeric f,
                               Numeric za) const;
 
-  //! FIXME: Will change in arts-3
+  /** Number of frequencies per block in planar_par
+   *
+   * A block's absorption for all levels is kept in memory as an
+   * [levels x planar_block_size] matrix
+   */
+  static constexpr Index planar_block_size = 1024;
+
+  /** Radiance for a block of frequencies with known absorption
+   *
+   * @param[out] rad The radiance [f.size() x levels]
+   * @param[in] f The frequencies of the block
+   * @param[in] abs The absorption [levels x f.size()]
+   * @param[in] za The zenith angle
+   */
+  void planar_block(MatrixView rad,
+                    const Vector& f,
+                    const ConstComplexMatrixView& abs,
+                    Numeric za) const;
+
+  /** FIXME: Will change in arts-3
+   *
+   * The frequencies are split into blocks of planar_block_size.  Each block
+   * evaluates the absorption of all levels with the vectorized
+   * full_absorption::at and then integrates all of its frequencies
+   * together.  Blocks are computed in parallel, or the levels of each block
+   * when there are fewer blocks than threads.
+   */
   [[nodiscard]] Matrix planar_par(const Vector& f, Numeric za) const;
   void planar_par(ExhaustiveMatrixView rad, const Vector& f, Numeric za) const;
 
@@ -9,6 +9,7 @@
 #include "gas_abs_lookup.h"
 #include <cfloat>
 #include <cmath>
+#include <limits>
 #include "check_input.h"
 #include "interp.h"
 #include "interpolation.h"
@@ -202,7 +203,23 @@ void GasAbsLookup::Adapt(const ArrayOfArrayOfSpeciesTag& current_species,
   //
   //     Dimension: [ a, b, c, d ]
   //
-  if (0 == n_nls) {
+  if (Storage() != GasAbsLookupStorage::Double) {
+    // The same checks for the table in reduced precision
+    const std::array<Index, 4> shape{
+        n_nls == 0 and 0 == t_pert.nelem() ? 1 : t_pert.nelem(),
+        n_species + n_nls * (n_nls_pert - 1),
+        n_f_grid,
+        n_p_grid};
+    if (xsec_compact.shape != shape) {
+      ostringstream os;
+      os << "The reduced precision cross sections should have dimensions ["
+         << shape[0] << ", " << shape[1] << ", " << shape[2] << ", "
+         << shape[3] << "], but they have dimensions ["
+         << xsec_compact.shape[0] << ", " << xsec_compact.shape[1] << ", "
+         << xsec_compact.shape[2] << ", " << xsec_compact.shape[3] << "].";
+      throw runtime_error(os.str());
+    }
+  } else if (0 == n_nls) {
     if (0 == t_pert.nelem()) {
       //     Simplest case (no temperature perturbations,
       //     no vmr perturbations):
@@ -384,50 +401,67 @@ void GasAbsLookup::Adapt(const ArrayOfArrayOfSpeciesTag& current_species,
     new_table.nls_pert = nls_pert;
   }
 
-  // Absorption coefficients:
-  new_table.xsec.resize(
-      xsec.nbooks(),
-      n_current_species + n_current_nonlinear_species * (n_nls_pert - 1),
-      n_current_f_grid,
-      xsec.ncols());
-
-  // We have to copy the right species and frequencies from the old to
-  // the new table. Temperature perturbations and pressure grid remain
-  // the same.
-
-  // Do species:
-  for (Index i_s = 0, sp = 0; i_s < n_current_species; ++i_s) {
-    // n_v is the number of VMR perturbations
-    Index n_v;
-    if (current_non_linear[i_s])
-      n_v = n_nls_pert;
-    else
-      n_v = 1;
-
-    //      cout << "i_s / sp / n_v = " << i_s << " / " << sp << " / " << n_v << endl;
-    //      cout << "orig_pos = " << original_spec_pos_in_xsec[i_current_species[i_s]] << endl;
-
-    // Do frequencies:
-    for (Index i_f = 0; i_f < n_current_f_grid; ++i_f) {
-      if (i_current_species[i_s] >= 0) {
-        new_table.xsec(Range(joker), Range(sp, n_v), i_f, Range(joker)) =
-            xsec(Range(joker),
-                 Range(original_spec_pos_in_xsec[i_current_species[i_s]], n_v),
-                 i_current_f_grid[i_f],
-                 Range(joker));
-      } else {
-        // Here we handle the case of the trivial species, which we simply
-        // set to NAN:
-        new_table.xsec(Range(joker), Range(sp, n_v), i_f, Range(joker)) = NAN;
+  // Absorption coefficients in reduced precision are selected without
+  // expanding them:
+  if (Storage() != GasAbsLookupStorage::Double) {
+    ArrayOfIndex pages;
+    for (Index i_s = 0; i_s < n_current_species; ++i_s) {
+      const Index n_v = current_non_linear[i_s] ? n_nls_pert : 1;
+      for (Index i_v = 0; i_v < n_v; ++i_v) {
+        pages.push_back(
+            i_current_species[i_s] >= 0
+                ? original_spec_pos_in_xsec[i_current_species[i_s]] + i_v
+                : -1);
       }
-
-      //           cout << "result: " << xsec( Range(joker),
-      //                                       Range(original_spec_pos_in_xsec[i_current_species[i_s]],n_v),
-      //                                       i_current_f_grid[i_f],
-      //                                       Range(joker) ) << endl;
     }
 
-    sp += n_v;
+    new_table.xsec_compact = xsec_compact.Select(pages, i_current_f_grid);
+  } else {
+    // Absorption coefficients:
+    new_table.xsec.resize(
+        xsec.nbooks(),
+        n_current_species + n_current_nonlinear_species * (n_nls_pert - 1),
+        n_current_f_grid,
+        xsec.ncols());
+
+    // We have to copy the right species and frequencies from the old to
+    // the new table. Temperature perturbations and pressure grid remain
+    // the same.
+
+    // Do species:
+    for (Index i_s = 0, sp = 0; i_s < n_current_species; ++i_s) {
+      // n_v is the number of VMR perturbations
+      Index n_v;
+      if (current_non_linear[i_s])
+        n_v = n_nls_pert;
+      else
+        n_v = 1;
+
+      //      cout << "i_s / sp / n_v = " << i_s << " / " << sp << " / " << n_v << endl;
+      //      cout << "orig_pos = " << original_spec_pos_in_xsec[i_current_species[i_s]] << endl;
+
+      // Do frequencies:
+      for (Index i_f = 0; i_f < n_current_f_grid; ++i_f) {
+        if (i_current_species[i_s] >= 0) {
+          new_table.xsec(Range(joker), Range(sp, n_v), i_f, Range(joker)) =
+              xsec(Range(joker),
+                   Range(original_spec_pos_in_xsec[i_current_species[i_s]], n_v),
+                   i_current_f_grid[i_f],
+                   Range(joker));
+        } else {
+          // Here we handle the case of the trivial species, which we simply
+          // set to NAN:
+          new_table.xsec(Range(joker), Range(sp, n_v), i_f, Range(joker)) = NAN;
+        }
+
+        //           cout << "result: " << xsec( Range(joker),
+        //                                       Range(original_spec_pos_in_xsec[i_current_species[i_s]],n_v),
+        //                                       i_current_f_grid[i_f],
+        //                                       Range(joker) ) << endl;
+      }
+
+      sp += n_v;
+    }
   }
 
   // 4. Replace original table by the new one.
@@ -506,6 +540,58 @@ void GasAbsLookup::Extract(Matrix& sga,
                            ConstVectorView abs_vmrs,
                            ConstVectorView new_f_grid,
                            const Numeric& extpolfac) const {
+  Matrix abs_vmrs_point(abs_vmrs.nelem(), 1);
+  abs_vmrs_point(joker, 0) = abs_vmrs;
+
+  Tensor3 sga_points;
+  Extract(sga_points,
+          select_abs_species,
+          p_interp_order,
+          t_interp_order,
+          h2o_interp_order,
+          f_interp_order,
+          Vector(1, p),
+          Vector(1, T),
+          abs_vmrs_point,
+          new_f_grid,
+          extpolfac);
+
+  sga = sga_points(0, joker, joker);
+}
+
+//! Extract scalar gas absorption coefficients for many atmospheric points.
+/*!
+  As the single point version above, but for all points of, e.g., a
+  propagation path at once. The table checks and the frequency grid
+  positions are only done once, and the pressure, temperature and H2O
+  interpolation weights of a point are combined before they are
+  applied to the table. The interpolation itself then runs over the
+  frequencies in the innermost loop.
+
+  \param[out] sga A Tensor3 with scalar gas absorption coefficients
+              [1/m]. Dimension is adjusted automatically to
+              [n_points, n_species, f_grid].
+
+  \param[in] p The pressures [Pa]. Dimension: [n_points].
+
+  \param[in] T The temperatures [K]. Dimension: [n_points].
+
+  \param[in] abs_vmrs The VMRs [absolute number]. Dimension:
+             [species, n_points].
+
+  See the single point version for the other parameters.
+*/
+void GasAbsLookup::Extract(Tensor3& sga,
+                           const ArrayOfSpeciesTag& select_abs_species,
+                           const Index& p_interp_order,
+                           const Index& t_interp_order,
+                           const Index& h2o_interp_order,
+                           const Index& f_interp_order,
+                           ConstVectorView p,
+                           ConstVectorView T,
+                           ConstMatrixView abs_vmrs,
+                           ConstVectorView new_f_grid,
+                           const Numeric& extpolfac) const {
   // 1. Obtain some properties of the lookup table:
 
   // Number of gas species in the table:
@@ -530,6 +616,9 @@ void GasAbsLookup::Extract(Matrix& sga,
   // want to extract.
   const Index n_new_f_grid = new_f_grid.nelem();
 
+  // Number of atmospheric points to extract absorption for.
+  const Index n_points = p.nelem();
+
   // 2. First some checks on the lookup table itself:
 
   // Most checks here are asserts, because they check the internal
@@ -561,27 +650,19 @@ void GasAbsLookup::Extract(Matrix& sga,
   ARTS_ASSERT(is_size(t_ref, n_p_grid));
 
   // Check dimension of xsec:
-  DEBUG_ONLY({
-    Index a, b, c, d;
-    if (0 == n_t_pert)
-      a = 1;
-    else
-      a = n_t_pert;
-    b = n_species + n_nls * (n_nls_pert - 1);
-    c = n_f_grid;
-    d = n_p_grid;
-    //       cout << "xsec: "
-    //            << xsec.nbooks() << ", "
-    //            << xsec.npages() << ", "
-    //            << xsec.nrows() << ", "
-    //            << xsec.ncols() << "\n";
-    //       cout << "a b c d: "
-    //            << a << ", "
-    //            << b << ", "
-    //            << c << ", "
-    //            << d << "\n";
-    ARTS_ASSERT(is_size(xsec, a, b, c, d));
-  })
+  const GasAbsLookupStorage this_storage = Storage();
+  ARTS_ASSERT(this_storage != GasAbsLookupStorage::Double or
+              is_size(xsec,
+                      n_t_pert == 0 ? 1 : n_t_pert,
+                      n_species + n_nls * (n_nls_pert - 1),
+                      n_f_grid,
+                      n_p_grid));
+  ARTS_ASSERT(this_storage == GasAbsLookupStorage::Double or
+              (xsec_compact.shape == std::array<Index, 4>{
+                   n_t_pert == 0 ? 1 : n_t_pert,
+                   n_species + n_nls * (n_nls_pert - 1),
+                   n_f_grid,
+                   n_p_grid}));
 
   // Make sure that log_p_grid is initialized:
   if (log_p_grid.nelem() != n_p_grid) {
@@ -632,8 +713,16 @@ void GasAbsLookup::Extract(Matrix& sga,
 
   // 3. Checks on the input variables:
 
+  // Check that the atmospheric points are consistent:
+  if (!is_size(T, n_points)) {
+    ostringstream os;
+    os << "Number of temperatures (" << T.nelem()
+       << ") does not match the number of pressures (" << n_points << ").";
+    throw runtime_error(os.str());
+  }
+
   // Check that abs_vmrs has the right dimension:
-  if (!is_size(abs_vmrs, n_species)) {
+  if (abs_vmrs.nrows() != n_species) {
     ostringstream os;
     os << "Number of species in lookup table does not match number\n"
        << "of species for which you want to extract absorption.\n"
@@ -642,6 +731,13 @@ void GasAbsLookup::Extract(Matrix& sga,
     throw runtime_error(os.str());
   }
 
+  if (abs_vmrs.ncols() != n_points) {
+    ostringstream os;
+    os << "Number of VMR points (" << abs_vmrs.ncols()
+       << ") does not match the number of pressures (" << n_points << ").";
+    throw runtime_error(os.str());
+  }
+
   // 4. Set up some things we will need later on:
 
   // 4.a Frequency grid positions
@@ -737,6 +833,20 @@ void GasAbsLookup::Extract(Matrix& sga,
     flag_local = my_interp::lagrange_interpolation_list<LagrangeInterpolation>(new_f_grid, f_grid, f_interp_order);
   }
 
+  // Flatten the frequency grid positions and weights, so that the
+  // interpolation loops below only read contiguous memory. With the
+  // default grid positions there is no frequency interpolation at all.
+  const bool do_f = flag != &flag_default;
+  const Index n_flx = f_interp_order + 1;
+  ArrayOfIndex fpos(do_f ? n_new_f_grid : 0);
+  Matrix flx(do_f ? n_new_f_grid : 0, n_flx);
+  if (do_f) {
+    for (Index fi = 0; fi < n_new_f_grid; ++fi) {
+      fpos[fi] = (*flag)[fi].pos;
+      for (Index k = 0; k < n_flx; ++k) flx(fi, k) = (*flag)[fi].lx[k];
+    }
+  }
+
   // 4.b Other stuff
 
   // Flag for temperature interpolation, if this is not 0 we want
@@ -749,163 +859,84 @@ void GasAbsLookup::Extract(Matrix& sga,
     non_linear[nonlinear_species[s]] = 1;
   }
 
-  // Calculate the number density for the given pressure and
-  // temperature:
-  // n = n0*T0/p0 * p/T or n = p/kB/t, ideal gas law
-  const Numeric n = number_density(p, T);
+  // The pressure range that is allowed. (p_grid is sorted in decreasing order.)
+  const Numeric p_max = p_grid[0] + 0.5 * (p_grid[0] - p_grid[1]);
+  const Numeric p_min = p_grid[n_p_grid - 1] -
+                        0.5 * (p_grid[n_p_grid - 2] - p_grid[n_p_grid - 1]);
+
+  // The temperature offset range that is allowed.
+  const Numeric t_min =
+      do_T ? t_pert[0] - extpolfac * (t_pert[1] - t_pert[0]) : 0;
+  const Numeric t_max =
+      do_T ? t_pert[n_t_pert - 1] +
+                 extpolfac * (t_pert[n_t_pert - 1] - t_pert[n_t_pert - 2])
+           : 0;
+
+  // The fractional H2O VMR range that is allowed.
+  // FIXME: This check depends on how I interpolate VMR.
+  const Numeric x_min =
+      n_nls > 0 ? nls_pert[0] - extpolfac * (nls_pert[1] - nls_pert[0]) : 0;
+  const Numeric x_max =
+      n_nls > 0 ? nls_pert[n_nls_pert - 1] +
+                      extpolfac * (nls_pert[n_nls_pert - 1] -
+                                   nls_pert[n_nls_pert - 2])
+                : 0;
+
+  // The interpolation that corresponds to "no interpolation at all".
+  const LagrangeInterpolation lag_trivial;
+
+  // Temperature and H2O(VMR) grid positions. These are reused for all
+  // points and pressure levels.
+  LagrangeInterpolation tlag_withT, vlag_h2o;
+
+  sga.resize(n_points, n_species, n_new_f_grid);
+  sga = 0;
 
-  // 5. Determine pressure grid position and interpolation weights:
+  for (Index ip = 0; ip < n_points; ++ip) {
+    // 5. Determine pressure grid position and interpolation weights:
 
-  // Check that p is inside the grid. (p_grid is sorted in decreasing order.)
-  {
-    const Numeric p_max = p_grid[0] + 0.5 * (p_grid[0] - p_grid[1]);
-    const Numeric p_min = p_grid[n_p_grid - 1] -
-                          0.5 * (p_grid[n_p_grid - 2] - p_grid[n_p_grid - 1]);
-    if ((p > p_max) || (p < p_min)) {
+    // Check that p is inside the grid.
+    if ((p[ip] > p_max) || (p[ip] < p_min)) {
       ostringstream os;
       os << "Problem with gas absorption lookup table.\n"
          << "Pressure p is outside the range covered by the lookup table.\n"
-         << "Your p value is " << p << " Pa.\n"
+         << "Your p value is " << p[ip] << " Pa.\n"
          << "The allowed range is " << p_min << " to " << p_max << ".\n"
          << "The pressure grid range in the table is " << p_grid[n_p_grid - 1]
          << " to " << p_grid[0] << ".\n"
          << "We allow a bit of extrapolation, but NOT SO MUCH!";
       throw runtime_error(os.str());
     }
-  }
-
-  // For sure, we need to store the pressure grid position.
-  // We do the interpolation in log(p). Test have shown that this
-  // gives slightly better accuracy than interpolating in p directly.
-  const auto plog=std::log(p);
-  ConstVectorView plog_v{plog};
-  const auto plag = my_interp::lagrange_interpolation_list<LagrangeInterpolation>(plog_v, log_p_grid, p_interp_order);
-
-  // Pressure interpolation weights:
-  const auto pitw = interpweights(plag[0]);
-
-  // Define also other grid positions and interpolation weights here, so that
-  // we do not have to allocate them over and over in the loops below.
-
-  // Define the ArrayOfLagrangeInterpolation that corresponds to "no interpolation at all".
-  const ArrayOfLagrangeInterpolation lag_trivial(1);
-
-  // Temperature grid positions.
-  ArrayOfLagrangeInterpolation tlag_withT(1);  // Only a scalar.
-  const ArrayOfLagrangeInterpolation* tlag;  // Pointer to either tlag_withT or lag_trivial.
-
-  // Set this_t_interp_order, depending on whether we do T interpolation or not.
-  if (do_T) {
-    tlag = &tlag_withT;
-  } else {
-    // For the !do_T case we simply take the single
-    // temperature that is there, so we point tgp accordingly.
-    tlag = &lag_trivial;
-  }
 
-  // H2O(VMR) grid positions. vlag is what will be used in the interpolation.
-  // Depending on species, it is either pointed to lag_trivial, or to vlag_h2o.
-  const ArrayOfLagrangeInterpolation* vlag;
-  ArrayOfLagrangeInterpolation vlag_h2o(1);  // only a scalar
-
-  // 6. We do the T and VMR interpolation for the pressure levels
-  // that are used in the pressure interpolation. (How many depends on
-  // p_interp_order.)
-
-  // To store the interpolated result for the p_interp_order+1
-  // pressure levels:
-  // xsec dimensions are:
-  //   Temperature
-  //   H2O
-  //   Frequency
-  //   Pressure
-  // Dimensions of pre_interpolated are:
-  //   Pressure    (interpolation points)
-  //   Species
-  //   Temperature (always 1)
-  //   H2O         (always 1)
-  //   Frequency
-
-  Tensor5 xsec_pre_interpolated;
-  xsec_pre_interpolated.resize(
-      p_interp_order + 1, n_species, 1, 1, n_new_f_grid);
-
-  // Define variables for interpolation weights outside the loops.
-  // We will make itw point to either the weights with H2O interpolation, or
-  // the ones without.
-  Tensor6 itw_withH2O{}, itw_noH2O{};
-  const Tensor6 *itw;
-
-  for (Index pi = 0; pi < p_interp_order + 1; ++pi) {
-    // Throw a runtime error if one of the reference VMR profiles is zero, but
-    // abs_vmrs is not. (This means that the lookup table was calculated with a
-    // reference profile of zero for that gas.)
-    //      for (Index si=0; si<n_species; ++si)
-    //        if ( (vmrs_ref(si,pi) == 0) &&
-    //            (abs_vmrs[si]    != 0) )
-    //        {
-    //          ostringstream os;
-    //          os << "Reference VMR profile is zero, you cannot extract\n"
-    //          << "Absorption for this species.\n"
-    //          << "Species: " << si
-    //          << " (" << get_species_name(species[si]) << ")\n"
-    //          << "Lookup table pressure level: " << pi
-    //          << " (" <<  p_grid[pi] << " Pa).";
-    //          throw runtime_error( os.str() );
-    //        }
-
-    // Index into p_grid:
-    const Index this_p_grid_index = plag[0].pos + pi;
-
-    // Determine temperature grid position. This is only done if we
-    // want temperature interpolation, but the variable tgp has to
-    // be visible also outside for later use:
-    if (do_T) {
-      // Temperature in the atmosphere is altitude
-      // dependent. When we do the interpolation for the pressure level
-      // below and above our point, we should correct the target value of
-      // the interpolation to the altitude (pressure) difference. This
-      // ensures that there is for example no T interpolation if the
-      // desired T is right on the reference profile curve.
-      //
-      // I explicitly compared this with the old option to calculate
-      // the temperature offset relative to the temperature at
-      // this level. The performance in both cases is very
-      // similar. The reason, why I decided to keep this new
-      // version, is that it avoids the problem of needing
-      // oversized temperature perturbations if the pressure
-      // grid is coarse.
-      //
-      // No! The above approach leads to problems when combined with
-      // higher order pressure interpolation. The problem is that
-      // the reference T and VMR profiles may be very
-      // irregular. (For example the H2O profile often has a big
-      // jump near the bottom.) That sometimes leads to negative
-      // effective reference values when the reference profile is
-      // interpolated. I therefore reverted back to the original
-      // version of using the real temperature and humidity, not
-      // the interpolated one.
-
-      //          const Numeric effective_T_ref = interp(pitw,t_ref,pgp);
-      const Numeric effective_T_ref = t_ref[this_p_grid_index];
-
-      // Convert temperature to offset from t_ref:
-      const Numeric T_offset = T - effective_T_ref;
-
-      //          cout << "T_offset = " << T_offset << endl;
-
-      // Check that temperature offset is inside the allowed range.
-      {
-        const Numeric t_min = t_pert[0] - extpolfac * (t_pert[1] - t_pert[0]);
-        const Numeric t_max =
-            t_pert[n_t_pert - 1] +
-            extpolfac * (t_pert[n_t_pert - 1] - t_pert[n_t_pert - 2]);
+    // We do the interpolation in log(p). Test have shown that this
+    // gives slightly better accuracy than interpolating in p directly.
+    const LagrangeInterpolation plag(
+        0, std::log(p[ip]), log_p_grid, p_interp_order);
+
+    // 6. We do the T and VMR interpolation for the pressure levels
+    // that are used in the pressure interpolation. (How many depends on
+    // p_interp_order.)
+    for (Index pi = 0; pi < p_interp_order + 1; ++pi) {
+      // Index into p_grid:
+      const Index this_p_grid_index = plag.pos + pi;
+
+      // Determine temperature grid position. We use the real
+      // temperature and humidity, not the reference profile
+      // interpolated to p, since the reference profiles may be very
+      // irregular. See the single point version for the full story.
+      if (do_T) {
+        const Numeric effective_T_ref = t_ref[this_p_grid_index];
+
+        // Convert temperature to offset from t_ref:
+        const Numeric T_offset = T[ip] - effective_T_ref;
+
+        // Check that temperature offset is inside the allowed range.
         if ((T_offset > t_max) || (T_offset < t_min)) {
           ostringstream os;
           os << "Problem with gas absorption lookup table.\n"
              << "Temperature T is outside the range covered by the lookup table.\n"
-             << "Your temperature was " << T << " K at a pressure of " << p
-             << " Pa.\n"
+             << "Your temperature was " << T[ip] << " K at a pressure of "
+             << p[ip] << " Pa.\n"
              << "The temperature offset value is " << T_offset << ".\n"
              << "The allowed range is " << t_min << " to " << t_max << ".\n"
              << "The temperature perturbation grid range in the table is "
@@ -913,55 +944,28 @@ void GasAbsLookup::Extract(Matrix& sga,
              << "We allow a bit of extrapolation, but NOT SO MUCH!";
           throw runtime_error(os.str());
         }
+
+        tlag_withT = LagrangeInterpolation(0, T_offset, t_pert, t_interp_order);
       }
+      const LagrangeInterpolation& tlag = do_T ? tlag_withT : lag_trivial;
 
-      tlag_withT[0] = LagrangeInterpolation(0, T_offset, t_pert, t_interp_order);
-    }
+      // Determine the H2O VMR grid position. The only species who's VMR
+      // is interpolated is H2O.
+      if (n_nls > 0) {
+        const Numeric effective_vmr_ref =
+            vmrs_ref(h2o_index, this_p_grid_index);
 
-    // Determine the H2O VMR grid position. We need to do this only
-    // once, since the only species who's VMR is interpolated is
-    // H2O. We do this only if there are nonlinear species, but the
-    // variable has to be visible later.
-    if (n_nls > 0) {
-      // Similar to the T case, we first interpolate the reference
-      // VMR to the pressure of extraction, then compare with
-      // the extraction VMR to determine the offset/fractional
-      // difference for the VMR interpolation.
-      //
-      // No! The above approach leads to problems when combined with
-      // higher order pressure interpolation. The problem is that
-      // the reference T and VMR profiles may be very
-      // irregular. (For example the H2O profile often has a big
-      // jump near the bottom.) That sometimes leads to negative
-      // effective reference values when the reference profile is
-      // interpolated. I therefore reverted back to the original
-      // version of using the real temperature and humidity, not
-      // the interpolated one.
-
-      //           const Numeric effective_vmr_ref = interp(pitw,
-      //                                                    vmrs_ref(h2o_index, Range(joker)),
-      //                                                    pgp);
-      const Numeric effective_vmr_ref = vmrs_ref(h2o_index, this_p_grid_index);
-
-      // Fractional VMR:
-      const Numeric VMR_frac = abs_vmrs[h2o_index] / effective_vmr_ref;
-
-      // Check that VMR_frac is inside the allowed range.
-      {
-        // FIXME: This check depends on how I interpolate VMR.
-        const Numeric x_min =
-            nls_pert[0] - extpolfac * (nls_pert[1] - nls_pert[0]);
-        const Numeric x_max =
-            nls_pert[n_nls_pert - 1] +
-            extpolfac * (nls_pert[n_nls_pert - 1] - nls_pert[n_nls_pert - 2]);
+        // Fractional VMR:
+        const Numeric VMR_frac = abs_vmrs(h2o_index, ip) / effective_vmr_ref;
 
+        // Check that VMR_frac is inside the allowed range.
         if ((VMR_frac > x_max) || (VMR_frac < x_min)) {
           ostringstream os;
           os << "Problem with gas absorption lookup table.\n"
              << "VMR for H2O (species " << h2o_index
              << ") is outside the range covered by the lookup table.\n"
-             << "Your VMR was " << abs_vmrs[h2o_index] << " at a pressure of "
-             << p << " Pa.\n"
+             << "Your VMR was " << abs_vmrs(h2o_index, ip)
+             << " at a pressure of " << p[ip] << " Pa.\n"
              << "The reference VMR value there is " << effective_vmr_ref << "\n"
              << "The fractional VMR relative to the reference value is "
              << VMR_frac << ".\n"
@@ -971,141 +975,328 @@ void GasAbsLookup::Extract(Matrix& sga,
              << "We allow a bit of extrapolation, but NOT SO MUCH!";
           throw runtime_error(os.str());
         }
+
+        // For now, do linear interpolation in the fractional VMR.
+        vlag_h2o = LagrangeInterpolation(0, VMR_frac, nls_pert, h2o_interp_order);
       }
 
-      // For now, do linear interpolation in the fractional VMR.
-      vlag_h2o[0] = LagrangeInterpolation(0, VMR_frac, nls_pert, h2o_interp_order);
-    }
+      // 7. Loop species:
+      Index fpi = 0;
+      for (Index si = 0; si < n_species; ++si) {
+        // Flag for VMR interpolation, if this is not 0 we want to
+        // do VMR interpolation:
+        const Index do_VMR = non_linear[si];
+
+        // Ignore species such as Zeeman and free_electrons which are not
+        // stored in the lookup table. For those the result is set to 0.
+        if (species[si].Zeeman() or species[si].FreeElectrons() or species[si].Particles()) {
+          if (do_VMR) {
+            ostringstream os;
+            os << "Problem with gas absorption lookup table.\n"
+               << "VMR interpolation is not allowed for species \""
+               << species[si][0].Name() << "\"";
+            throw runtime_error(os.str());
+          }
+          fpi++;
+          continue;
+        }
 
-    // Precalculate interpolation weights.
-    if (n_nls < n_species) {
-      // Precalculate weights without H2O interpolation if there are less
-      // nonlinear species than total species. (So at least one species
-      // without H2O interpolation.)
-      itw_noH2O = interpweights(*tlag, lag_trivial, *flag);
-    }
-    if (n_nls > 0) {
-      // Precalculate weights with H2O interpolation if there is at least
-      // one nonlinear species.
-      itw_withH2O = interpweights(*tlag, vlag_h2o, *flag);
-    }
+        const LagrangeInterpolation& vlag = do_VMR ? vlag_h2o : lag_trivial;
+
+        // For interpolation result. Fixed point and species.
+        VectorView res = sga(ip, si, joker);
+
+        // Add the contribution of all temperature and H2O grid points
+        // with their combined weights. The frequency is the innermost
+        // loop. The table frequency index is mapped to a cross section
+        // by this_xsec, which reads the table in its storage precision.
+        const auto add_weighted = [&](Numeric w, auto&& this_xsec) {
+          if (do_f) {
+            for (Index fi = 0; fi < n_new_f_grid; ++fi) {
+              Numeric x = 0;
+              for (Index k = 0; k < n_flx; ++k) {
+                x += flx(fi, k) * this_xsec(fpos[fi] + k);
+              }
+              res[fi] += w * x;
+            }
+          } else {
+            for (Index fi = 0; fi < n_new_f_grid; ++fi) {
+              res[fi] += w * this_xsec(fi);
+            }
+          }
+        };
+
+        for (Index it = 0; it < tlag.size(); ++it) {
+          for (Index iv = 0; iv < vlag.size(); ++iv) {
+            const Numeric w = plag.lx[pi] * tlag.lx[it] * vlag.lx[iv];
+            const Index t_index = tlag.pos + it;
+            const Index v_index = fpi + vlag.pos + iv;
+
+            switch (this_storage) {
+              case GasAbsLookupStorage::Double: {
+                const ConstVectorView this_xsec =
+                    xsec(t_index, v_index, joker, this_p_grid_index);
+                add_weighted(w, [&](Index f) { return this_xsec[f]; });
+              } break;
+              case GasAbsLookupStorage::Float: {
+                const float* this_xsec =
+                    xsec_compact.f32.data() +
+                    xsec_compact.FlatIndex(t_index, v_index, 0, this_p_grid_index);
+                add_weighted(w, [&](Index f) {
+                  return static_cast<Numeric>(this_xsec[f * n_p_grid]);
+                });
+              } break;
+              case GasAbsLookupStorage::Log16: {
+                const std::uint16_t* this_xsec =
+                    xsec_compact.q16.data() +
+                    xsec_compact.FlatIndex(t_index, v_index, 0, this_p_grid_index);
+                const Numeric offset =
+                    xsec_compact.log_offset(t_index, v_index, this_p_grid_index);
+                const Numeric step =
+                    xsec_compact.log_step(t_index, v_index, this_p_grid_index);
+                add_weighted(w, [&](Index f) {
+                  return CompactCrossSections::Decode(
+                      this_xsec[f * n_p_grid], offset, step);
+                });
+              } break;
+              case GasAbsLookupStorage::FINAL:
+                ARTS_ASSERT(false)
+            }
+          }
+        }
 
-    // 7. Loop species:
-    Index fpi = 0;
+        // Increase fpi. fpi marks the position of the first profile
+        // of the current species in xsec. This is needed to find
+        // the right subsection of xsec in the presence of nonlinear species.
+        if (do_VMR)
+          fpi += n_nls_pert;
+        else
+          fpi++;
+
+      }  // End of species loop
+
+      // fpi should have reached the end of that dimension of xsec. Check
+      // this with an assertion:
+      ARTS_ASSERT(fpi == (this_storage == GasAbsLookupStorage::Double
+                              ? xsec.npages()
+                              : xsec_compact.shape[1]));
+
+    }  // End of pressure index loop (below and above gp)
+
+    // Watch out, this is not yet the final result, we
+    // need to multiply with the number density of the species, i.e.,
+    // with the total number density n, times the VMR of the
+    // species:
+    // n = n0*T0/p0 * p/T or n = p/kB/t, ideal gas law
+    const Numeric n = number_density(p[ip], T[ip]);
     for (Index si = 0; si < n_species; ++si) {
-      // Flag for VMR interpolation, if this is not 0 we want to
-      // do VMR interpolation:
-      const Index do_VMR = non_linear[si];
-
-      // For interpolation result.
-      // Fixed pressure level and species.
-      // Free dimension is T, H2O, and frequency.
-      Tensor3View res(xsec_pre_interpolated(
-          pi, si, Range(joker), Range(joker), Range(joker)));
-
-      // Ignore species such as Zeeman and free_electrons which are not
-      // stored in the lookup table. For those the result is set to 0.
-      if (species[si].Zeeman() or species[si].FreeElectrons() or species[si].Particles()) {
-        if (do_VMR) {
-          ostringstream os;
-          os << "Problem with gas absorption lookup table.\n"
-             << "VMR interpolation is not allowed for species \""
-             << species[si][0].Name() << "\"";
-          throw runtime_error(os.str());
+      if (select_abs_species.nelem() and species[si] != select_abs_species)
+        sga(ip, si, joker) = 0.;
+      else
+        sga(ip, si, joker) *= (n * abs_vmrs(si, ip));
+    }
+  }  // End of point loop
+
+  // That's it, we're done!
+}
+
+const Vector& GasAbsLookup::GetFgrid() const { return f_grid; }
+
+const Vector& GasAbsLookup::GetPgrid() const { return p_grid; }
+
+//! Compress lookup table cross sections.
+/*!
+  \param xsec    The cross sections, dimension [a, b, c, d] as
+                 GasAbsLookup::xsec.
+  \param storage The reduced precision to store them in. Must not be
+                 GasAbsLookupStorage::Double.
+*/
+CompactCrossSections::CompactCrossSections(const Tensor4& xsec,
+                                           GasAbsLookupStorage storage_)
+    : storage(storage_),
+      shape({xsec.nbooks(), xsec.npages(), xsec.nrows(), xsec.ncols()}) {
+  switch (storage) {
+    case GasAbsLookupStorage::Double:
+      ARTS_USER_ERROR("Compact cross sections cannot be of double precision")
+    case GasAbsLookupStorage::Float:
+      f32.assign(xsec.elem_begin(), xsec.elem_end());
+      break;
+    case GasAbsLookupStorage::Log16: {
+      constexpr Numeric qmax = std::numeric_limits<std::uint16_t>::max();
+
+      q16.resize(xsec.size());
+      log_offset.resize(shape[0], shape[1], shape[3]);
+      log_step.resize(shape[0], shape[1], shape[3]);
+      for (Index b = 0; b < shape[0]; b++) {
+        for (Index p = 0; p < shape[1]; p++) {
+          for (Index c = 0; c < shape[3]; c++) {
+            const ConstVectorView x = xsec(b, p, joker, c);
+
+            // The range of the logarithm of the positive values. A slice
+            // with NaN gets a NaN offset so that it decodes to NaN.
+            Numeric lo = std::numeric_limits<Numeric>::infinity();
+            Numeric hi = -lo;
+            bool has_nan = false;
+            for (auto v : x) {
+              if (std::isnan(v)) has_nan = true;
+              if (v > 0) {
+                lo = std::min(lo, std::log(v));
+                hi = std::max(hi, std::log(v));
+              }
+            }
+
+            if (has_nan) {
+              log_offset(b, p, c) = NAN;
+              log_step(b, p, c) = 0;
+              for (Index r = 0; r < shape[2]; r++) q16[FlatIndex(b, p, r, c)] = 1;
+              continue;
+            }
+
+            // Values are decoded as exp(offset + step * q) for q in [1, qmax]
+            const Numeric step = hi > lo ? (hi - lo) / (qmax - 1) : 0.0;
+            log_step(b, p, c) = step;
+            log_offset(b, p, c) = lo - step;
+            for (Index r = 0; r < shape[2]; r++) {
+              q16[FlatIndex(b, p, r, c)] =
+                  x[r] > 0 ? static_cast<std::uint16_t>(
+                                 step > 0 ? 1 + std::round((std::log(x[r]) - lo) / step)
+                                          : 1)
+                           : 0;
+            }
+          }
         }
-        res = 0.;
-        fpi++;
-        continue;
       }
+    } break;
+    case GasAbsLookupStorage::FINAL:
+      ARTS_ASSERT(false)
+  }
+}
 
-      // Set h2o related interpolation parameters:
-      Index this_h2o_extent;  // Range of H2O interpolation
-      if (do_VMR) {
-        vlag = &vlag_h2o;
-        this_h2o_extent = n_nls_pert;
-        itw = &itw_withH2O;
-      } else {
-        vlag = &lag_trivial;
-        this_h2o_extent = 1;
-        itw = &itw_noH2O;
+//! Decompress lookup table cross sections.
+/*!
+  \return The cross sections in double precision, dimension [a, b, c, d].
+*/
+Tensor4 CompactCrossSections::Expand() const {
+  Tensor4 xsec(shape[0], shape[1], shape[2], shape[3]);
+  for (Index b = 0; b < shape[0]; b++) {
+    for (Index p = 0; p < shape[1]; p++) {
+      for (Index r = 0; r < shape[2]; r++) {
+        for (Index c = 0; c < shape[3]; c++) {
+          xsec(b, p, r, c) = operator()(b, p, r, c);
+        }
       }
+    }
+  }
+  return xsec;
+}
 
-      // Get the right view on xsec.
-      ConstTensor3View this_xsec =
-          xsec(Range(joker),                 // Temperature range
-               Range(fpi, this_h2o_extent),  // VMR profile range
-               Range(joker),                 // Frequency range
-               this_p_grid_index);           // Pressure index
-
-      // Do interpolation.
-      reinterp(res,        // result
-               this_xsec,  // input
-               *itw,       // weights
-               *tlag,
-               *vlag,
-               *flag);  // grid positions
-
-      // Increase fpi. fpi marks the position of the first profile
-      // of the current species in xsec. This is needed to find
-      // the right subsection of xsec in the presence of nonlinear species.
-      if (do_VMR)
-        fpi += n_nls_pert;
-      else
-        fpi++;
+//! Select parts of lookup table cross sections.
+/*!
+  This is used to adapt a table without decompressing it. The values are
+  copied as they are, so no precision is lost.
 
-    }  // End of species loop
+  \param pages The VMR profiles to keep, in the new order. A negative
+               index gives a profile of NaN.
+  \param rows  The frequencies to keep, in the new order.
+  \return The selected cross sections, dimension [a, pages, rows, d].
+*/
+CompactCrossSections CompactCrossSections::Select(
+    const ArrayOfIndex& pages, const ArrayOfIndex& rows) const {
+  CompactCrossSections out;
+  out.storage = storage;
+  out.shape = {shape[0], pages.nelem(), rows.nelem(), shape[3]};
+
+  const Index n = shape[0] * pages.nelem() * rows.nelem() * shape[3];
+  if (storage == GasAbsLookupStorage::Log16) {
+    out.q16.resize(n);
+    out.log_offset.resize(out.shape[0], out.shape[1], out.shape[3]);
+    out.log_step.resize(out.shape[0], out.shape[1], out.shape[3]);
+  } else {
+    out.f32.resize(n);
+  }
 
-    // fpi should have reached the end of that dimension of xsec. Check
-    // this with an assertion:
-    ARTS_ASSERT(fpi == xsec.npages());
+  for (Index b = 0; b < shape[0]; b++) {
+    for (Index p = 0; p < pages.nelem(); p++) {
+      const Index op = pages[p];
+      for (Index c = 0; c < shape[3]; c++) {
+        if (storage == GasAbsLookupStorage::Log16) {
+          out.log_offset(b, p, c) = op < 0 ? NAN : log_offset(b, op, c);
+          out.log_step(b, p, c) = op < 0 ? 0 : log_step(b, op, c);
+        }
+      }
 
-  }  // End of pressure index loop (below and above gp)
+      for (Index r = 0; r < rows.nelem(); r++) {
+        for (Index c = 0; c < shape[3]; c++) {
+          const Index i = out.FlatIndex(b, p, r, c);
+          if (storage == GasAbsLookupStorage::Log16) {
+            out.q16[i] = op < 0 ? 1 : q16[FlatIndex(b, op, rows[r], c)];
+          } else {
+            out.f32[i] = op < 0 ? NAN : f32[FlatIndex(b, op, rows[r], c)];
+          }
+        }
+      }
+    }
+  }
 
-  // Now we have to interpolate between the p_interp_order+1 pressure levels
+  return out;
+}
 
-  // It is a "red" 1D interpolation case we are talking about here.
-  // (But for a matrix in frequency and species.) Doing a loop over
-  // frequency and species with an interp call inside would be
-  // unefficient, so we do this by hand here.
-  sga.resize(n_species, n_new_f_grid);
-  sga = 0;
-  for (Index pi = 0; pi < p_interp_order + 1; ++pi) {
-    // Multiply pre interpolated quantities with pressure interpolation weights.
-    // Dimensions of pre_interpolated are:
-    //   Pressure    (interpolation points)
-    //   Species
-    //   Temperature (always 1)
-    //   H2O         (always 1)
-    //   Frequency
-    xsec_pre_interpolated(
-        pi, Range(joker), Range(joker), Range(joker), Range(joker)) *= pitw[pi];
-
-    // Add up in sga.
-    // Dimensions of sga are (species, frequency)
-    sga += xsec_pre_interpolated(pi, Range(joker), 0, 0, Range(joker));
+Numeric CompactCrossSections::operator()(Index b,
+                                         Index p,
+                                         Index r,
+                                         Index c) const {
+  const Index i = FlatIndex(b, p, r, c);
+  switch (storage) {
+    case GasAbsLookupStorage::Float:
+      return f32[i];
+    case GasAbsLookupStorage::Log16:
+      return Decode(q16[i], log_offset(b, p, c), log_step(b, p, c));
+    case GasAbsLookupStorage::Double:
+    case GasAbsLookupStorage::FINAL:
+      break;
   }
+  ARTS_ASSERT(false, "Cannot access double precision compact cross sections")
+  return NAN;
+}
 
-  // Watch out, this is not yet the final result, we
-  // need to multiply with the number density of the species, i.e.,
-  // with the total number density n, times the VMR of the
-  // species:
-  for (Index si = 0; si < n_species; ++si) {
-    if (select_abs_species.nelem()) {
-      if (species[si] == select_abs_species)
-        sga(si, Range(joker)) *= (n * abs_vmrs[si]);
-      else
-        sga(si, Range(joker)) = 0.;
-    } else {
-      sga(si, Range(joker)) *= (n * abs_vmrs[si]);
-    }
+//! Change the precision that the cross sections are stored in.
+/*!
+  Going to a reduced precision replaces xsec by xsec_compact. Going back
+  to double precision expands xsec_compact again, but the precision that
+  was lost is of course not recovered.
+
+  \param new_storage The new precision.
+
+  \return The largest relative error of the positive cross sections that
+          the new precision introduced, zero if it is not reduced.
+*/
+Numeric GasAbsLookup::SetStorage(GasAbsLookupStorage new_storage) {
+  const GasAbsLookupStorage old_storage = Storage();
+  if (old_storage == new_storage) return 0.0;
+
+  if (old_storage != GasAbsLookupStorage::Double) {
+    xsec = xsec_compact.Expand();
+    xsec_compact = CompactCrossSections{};
   }
 
-  // That's it, we're done!
-}
+  Numeric max_rel_error = 0.0;
+  if (new_storage != GasAbsLookupStorage::Double) {
+    xsec_compact = CompactCrossSections(xsec, new_storage);
 
-const Vector& GasAbsLookup::GetFgrid() const { return f_grid; }
+    for (Index b = 0; b < xsec.nbooks(); b++)
+      for (Index p = 0; p < xsec.npages(); p++)
+        for (Index r = 0; r < xsec.nrows(); r++)
+          for (Index c = 0; c < xsec.ncols(); c++)
+            if (const Numeric x = xsec(b, p, r, c); x > 0)
+              max_rel_error =
+                  std::max(max_rel_error,
+                           std::abs(xsec_compact(b, p, r, c) - x) / x);
 
-const Vector& GasAbsLookup::GetPgrid() const { return p_grid; }
+    xsec = Tensor4{};
+  }
+
+  return max_rel_error;
+}
 
 /** Output operatior for GasAbsLookup. */
 ostream& operator<<(ostream& os, const GasAbsLookup& /* gal */) {
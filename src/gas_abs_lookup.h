@@ -11,16 +11,83 @@
 
 #include "species_tags.h"
 #include "absorption.h"
+#include "enums.h"
 #include "interp.h"
 #include "matpack_data.h"
 #include "messages.h"
 
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
 // Declare existance of some classes:
 class bifstream;
 class bofstream;
 class Agenda;
 class Workspace;
 
+//! The precision that lookup table cross sections are stored in
+ENUMCLASS(GasAbsLookupStorage, char,
+  Double,
+  Float,
+  Log16)
+
+//! Reduced precision copy of the cross sections of a lookup table
+/*! The layout is that of GasAbsLookup::xsec, [T, VMR, f, p], flattened
+    in row-major order.
+
+    With GasAbsLookupStorage::Float the values are stored in single
+    precision. With GasAbsLookupStorage::Log16 the natural logarithm of
+    each positive value is quantized to 16 bits, with an offset and a step
+    that are set per (T, VMR, p) slice, i.e., per spectrum. The relative
+    error is then at most half of the step, which is the log-range of the
+    spectrum divided by 65534. Zero and negative values are stored as
+    zero. */
+struct CompactCrossSections {
+  GasAbsLookupStorage storage{GasAbsLookupStorage::Double};
+
+  //! The dimensions of the cross sections [a, b, c, d]
+  std::array<Index, 4> shape{};
+
+  //! The cross sections for GasAbsLookupStorage::Float
+  std::vector<float> f32{};
+
+  //! The quantized cross sections for GasAbsLookupStorage::Log16
+  std::vector<std::uint16_t> q16{};
+
+  //! Offset and step of the logarithm per slice, dimension [a, b, d]
+  Tensor3 log_offset{};
+  Tensor3 log_step{};
+
+  CompactCrossSections() = default;
+
+  // Documentation is with the implementation!
+  CompactCrossSections(const Tensor4& xsec, GasAbsLookupStorage storage);
+
+  // Documentation is with the implementation!
+  [[nodiscard]] Tensor4 Expand() const;
+
+  // Documentation is with the implementation!
+  [[nodiscard]] CompactCrossSections Select(const ArrayOfIndex& pages,
+                                            const ArrayOfIndex& rows) const;
+
+  //! The position of element (b, p, r, c) in f32 or q16
+  [[nodiscard]] Index FlatIndex(Index b, Index p, Index r, Index c) const {
+    return ((b * shape[1] + p) * shape[2] + r) * shape[3] + c;
+  }
+
+  //! Decode a quantized value with the offset and step of its slice
+  [[nodiscard]] static Numeric Decode(std::uint16_t q,
+                                      Numeric offset,
+                                      Numeric step) {
+    return q == 0 ? 0.0 : std::exp(offset + step * static_cast<Numeric>(q));
+  }
+
+  //! The value of element (b, p, r, c)
+  [[nodiscard]] Numeric operator()(Index b, Index p, Index r, Index c) const;
+};
+
 //! An absorption lookup table.
 /*! This class holds an absorption lookup table, as well as all
     information that is necessary to use the table to extract
@@ -44,6 +111,14 @@ class GasAbsLookup {
              ConstVectorView current_f_grid,
              const Verbosity& verbosity);
 
+  // Documentation is with the implementation!
+  Numeric SetStorage(GasAbsLookupStorage new_storage);
+
+  /** The precision that the cross sections are stored in */
+  [[nodiscard]] GasAbsLookupStorage Storage() const {
+    return xsec_compact.storage;
+  }
+
   // Documentation is with the implementation!
   void Extract(Matrix& sga,
                const ArrayOfSpeciesTag& select_abs_species,
@@ -57,6 +132,19 @@ class GasAbsLookup {
                ConstVectorView new_f_grid,
                const Numeric& extpolfac) const;
 
+  // Documentation is with the implementation!
+  void Extract(Tensor3& sga,
+               const ArrayOfSpeciesTag& select_abs_species,
+               const Index& p_interp_order,
+               const Index& t_interp_order,
+               const Index& h2o_interp_order,
+               const Index& f_interp_order,
+               ConstVectorView p,
+               ConstVectorView T,
+               ConstMatrixView abs_vmrs,
+               ConstVectorView new_f_grid,
+               const Numeric& extpolfac) const;
+
   const Vector& GetFgrid() const;
 
   const Vector& GetPgrid() const;
@@ -162,6 +250,13 @@ class GasAbsLookup {
   /** Absorption cross sections */
   Tensor4& Xsec() {return xsec;}
 
+  /** Replace the absorption cross sections, which are then stored in
+      double precision */
+  void SetXsec(Tensor4 new_xsec) {
+    xsec = std::move(new_xsec);
+    xsec_compact = CompactCrossSections{};
+  }
+
   friend ostream& operator<<(ostream& os, const GasAbsLookup& gal);
   
  private:
@@ -278,8 +373,17 @@ class GasAbsLookup {
 
     Note that the last three dimensions are identical to the
     dimensions of abs_per_tg in ARTS-1-0. This should simplify
-    computation of the lookup table with the old ARTS version.  */
+    computation of the lookup table with the old ARTS version.
+
+    This is empty if the table is stored in reduced precision, see
+    xsec_compact.  */
   Tensor4 xsec;
+
+  //! Absorption cross sections in reduced precision.
+  /*! Only used if the storage is not GasAbsLookupStorage::Double, in
+    which case it holds the cross sections instead of xsec. Set by
+    SetStorage. */
+  CompactCrossSections xsec_compact;
 };
 
 #endif  //  gas_abs_lookup_h
@@ -4,7 +4,11 @@
 #include "partfun.h"
 
 #include <algorithm>
+#include <bit>
 #include <cmath>
+#include <concepts>
+#include <cstdint>
+#include <type_traits>
 
 #include "lineshape.h"
 #include "physics_funcs.h"
@@ -2211,11 +2215,12 @@ struct ComputeValues {
   const Index size;
   const ArrayOfDerivatives &derivs;
   const Index jac_size;
+  const Index jac_stride;
   const Index max_jac_size;
   const bool do_nlte;
 
   [[nodiscard]] Index jac_pos(Index iv, Index ij) const noexcept {
-    return jac_size * iv + ij;
+    return jac_stride * ij + iv;
   }
 
   ComputeValues(ComplexVector &F_, ComplexMatrix &dF_, ComplexVector &N_,
@@ -2223,18 +2228,18 @@ struct ComputeValues {
                 const Index nv, const ArrayOfDerivatives &derivs_,
                 const bool do_nlte_) noexcept
       : F(F_.data_handle() + start),
-        dF(dF_.data_handle() + start * derivs_.size()),
-        N(N_.data_handle() + start),
-        dN(dN_.data_handle() + start * derivs_.size()),
+        dF(dF_.empty() ? nullptr : dF_.data_handle() + start),
+        N(N_.empty() ? nullptr : N_.data_handle() + start),
+        dN(dN_.empty() ? nullptr : dN_.data_handle() + start),
         f(f_grid.data_handle() + start), size(nv), derivs(derivs_),
-        jac_size(derivs_.size()), max_jac_size(active_nelem(derivs)),
-        do_nlte(do_nlte_) {}
+        jac_size(derivs_.size()), jac_stride(dF_.ncols()),
+        max_jac_size(active_nelem(derivs)), do_nlte(do_nlte_) {}
 
   ComputeValues(Complex &F_, std::vector<Complex> &dF_, Complex &N_,
                 std::vector<Complex> &dN_, const Numeric &f_lim,
                 const ArrayOfDerivatives &derivs_, const bool do_nlte_) noexcept
       : F(&F_), dF(dF_.data()), N(&N_), dN(dN_.data()), f(&f_lim), size(1),
-        derivs(derivs_), jac_size(derivs.nelem()),
+        derivs(derivs_), jac_size(derivs.nelem()), jac_stride(1),
         max_jac_size(active_nelem(derivs)), do_nlte(do_nlte_) {}
 
   ComputeValues &operator-=(const ComputeValues &cut) ARTS_NOEXCEPT {
@@ -2244,14 +2249,16 @@ struct ComputeValues {
     for (Index iv = 0; iv < size; iv++) {
       F[iv] -= *cut.F;
       for (Index ij = 0; ij < max_jac_size; ij++) {
-        dF[jac_pos(iv, derivs[ij].jac_pos)] -= cut.dF[derivs[ij].jac_pos];
+        dF[jac_pos(iv, derivs[ij].jac_pos)] -=
+            cut.dF[cut.jac_pos(0, derivs[ij].jac_pos)];
       }
     }
     if (do_nlte) {
       for (Index iv = 0; iv < size; iv++) {
         N[iv] -= *cut.N;
         for (Index ij = 0; ij < max_jac_size; ij++) {
-          dN[jac_pos(iv, derivs[ij].jac_pos)] -= cut.dN[derivs[ij].jac_pos];
+          dN[jac_pos(iv, derivs[ij].jac_pos)] -=
+              cut.dN[cut.jac_pos(0, derivs[ij].jac_pos)];
         }
       }
     }
@@ -2598,6 +2605,104 @@ IntensityCalculator::IntensityCalculator(
           InternalDerivativesSetupImpl(X, X2 __VA_OPT__(, __VA_ARGS__))        \
               InternalDerivativesSetupImpl(X, X3 __VA_OPT__(, __VA_ARGS__))
 
+//! Line shapes with a specialized frequency loop
+template <typename T>
+concept PlainLineShape =
+    std::same_as<T, Voigt> or std::same_as<T, SpeedDependentVoigt>;
+
+//! Mirrored line shapes with a specialized frequency loop
+template <typename T>
+concept PlainMirroredLineShape = PlainLineShape<T> or
+                                 std::same_as<T, Noshape> or
+                                 std::same_as<T, Lorentz>;
+
+//! Normalizations with a specialized frequency loop
+template <typename T>
+concept PlainNormalizer =
+    std::same_as<T, Nonorm> or std::same_as<T, VanVleckHuber>;
+
+/** Frequency loop of the line shape call for known types and no derivatives
+ *
+ * Computes the same F and N as frequency_loop and cutoff_frequency_loop, but
+ * with the types of the line shape, mirrored line shape, and normalization
+ * known at compile time.  The calls in the loop are then inlined instead of
+ * going through a std::visit per frequency.  The loop is not vectorized, as
+ * the Faddeeva function and the speed-dependent Voigt calculation branch on
+ * their argument for every frequency.
+ *
+ * @param[in,out] com The values to add to
+ * @param[in] ls The line shape. \f$ F_i \f$
+ * @param[in] ls_mirr The mirrored line shape. \f$ F^M_i \f$
+ * @param[in] ls_norm The normalization. \f$ S_n \f$
+ * @param[in] Fcut The line shape and mirrored line shape at the cutoff
+ * @param[in] SLM The product \f$ S_z S_i S_{lm} \f$
+ * @param[in] DSLM The product \f$ S_z N_i S_{lm} \f$
+ */
+template <bool do_nlte, PlainLineShape LS, PlainMirroredLineShape LSM,
+          PlainNormalizer LSN>
+void plain_frequency_loop(ComputeValues &com, LS ls, LSM ls_mirr, LSN ls_norm,
+                          const Complex Fcut, const Complex SLM,
+                          const Complex DSLM) noexcept {
+  const Index nv = com.size;
+  for (Index iv = 0; iv < nv; iv++) {
+    const Numeric f = com.f[iv];
+
+    const Numeric Sn = ls_norm(f);
+    const Complex Fls = ls(f) + std::conj(ls_mirr(f)) - Fcut;
+    com.F[iv] += Sn * SLM * Fls;
+    if constexpr (do_nlte) {
+      com.N[iv] += Sn * DSLM * Fls;
+    }
+  }
+}
+
+/** Select a specialized frequency loop for the types of this line
+ *
+ * The combination of line shape, mirroring, and normalization is resolved
+ * once here instead of for every frequency.  This covers the Voigt and
+ * speed-dependent Voigt line shapes without normalization or with Van
+ * Vleck-Huber normalization when no derivatives are required.
+ *
+ * @param[in,out] com The values to add to
+ * @param[in] ls The line shape calculator. \f$ F_i \f$
+ * @param[in] ls_mirr The mirrored line shape calculator. \f$ F^M_i \f$
+ * @param[in] ls_norm The normalization calculator. \f$ S_n \f$
+ * @param[in] Fcut The line shape and mirrored line shape at the cutoff
+ * @param[in] ls_str The line strength calculator. \f$ S_i \f$
+ * @param[in] LM The line mixing scaling. \f$ S_{lm} \f$
+ * @param[in] Sz The relative Zeeman strength. \f$ S_z \f$
+ * @return true if the values were computed, false if the generic loop is
+ * required
+ */
+bool plain_frequency_loop(ComputeValues &com, const Calculator &ls,
+                          const Calculator &ls_mirr, const Normalizer &ls_norm,
+                          const Complex Fcut, const IntensityCalculator &ls_str,
+                          const Complex LM, const Numeric Sz) noexcept {
+  if (com.max_jac_size not_eq 0) return false;
+
+  const Complex SLM = Sz * ls_str.S() * LM;
+  const Complex DSLM = Sz * ls_str.N() * LM;
+  return std::visit(
+      [&](const auto &LS, const auto &LSM, const auto &LSN) {
+        using LS_t = std::remove_cvref_t<decltype(LS)>;
+        using LSM_t = std::remove_cvref_t<decltype(LSM)>;
+        using LSN_t = std::remove_cvref_t<decltype(LSN)>;
+        if constexpr (PlainLineShape<LS_t> and
+                      PlainMirroredLineShape<LSM_t> and
+                      PlainNormalizer<LSN_t>) {
+          if (com.do_nlte) {
+            plain_frequency_loop<true>(com, LS, LSM, LSN, Fcut, SLM, DSLM);
+          } else {
+            plain_frequency_loop<false>(com, LS, LSM, LSN, Fcut, SLM, DSLM);
+          }
+          return true;
+        } else {
+          return false;
+        }
+      },
+      ls.data(), ls_mirr.data(), ls_norm.data());
+}
+
 /** Cutoff frequency loop of the line shape call
  *
  * This simply adds to the four output vectors/matrices for
@@ -2669,6 +2774,11 @@ void cutoff_frequency_loop(ComputeValues &com, Calculator &ls,
                            const Numeric &T, const Numeric &dfdH,
                            const Numeric &Sz,
                            const Species::Species self_species) ARTS_NOEXCEPT {
+  if (plain_frequency_loop(com, ls, ls_mirr, ls_norm,
+                           ls_cut.F() + std::conj(ls_mirr_cut.F()), ls_str, LM,
+                           Sz))
+    return;
+
   const Index nv = com.size;
   const bool do_nlte = com.do_nlte;
 
@@ -2892,6 +3002,9 @@ void frequency_loop(ComputeValues &com, Calculator &ls, Calculator &ls_mirr,
                     const ArrayOfDerivatives &derivs, const Complex LM,
                     const Numeric &T, const Numeric &dfdH, const Numeric &Sz,
                     const Species::Species self_species) ARTS_NOEXCEPT {
+  if (plain_frequency_loop(com, ls, ls_mirr, ls_norm, 0, ls_str, LM, Sz))
+    return;
+
   const Index nv = com.size;
   const bool do_nlte = com.do_nlte;
 
@@ -3375,7 +3488,8 @@ void line_loop(ComputeData &com, ComputeData &sparse_com,
                const Numeric QT, const Numeric QT0, const Numeric dQTdT,
                const Numeric r, const Numeric drdSELFVMR, const Numeric drdT,
                const Zeeman::Polarization zeeman_polarization,
-               const Options::LblSpeedup speedup_type) ARTS_NOEXCEPT {
+               const Options::LblSpeedup speedup_type,
+               const ParameterCache::Entry *cached) ARTS_NOEXCEPT {
   const Index nj = jacobian_quantities.nelem();
   const Index nl = band.NumLines();
 
@@ -3431,32 +3545,32 @@ void line_loop(ComputeData &com, ComputeData &sparse_com,
       std::remove_if(derivs.begin(), derivs.end(),
                      [](Derivatives &dd) { return dd.deriv == nullptr; });
 
+      // The line parameters, possibly from the cache
+      const Normalizer ls_norm =
+          cached ? cached->norm[i]
+                 : Normalizer(band.normalization, band.lines[i].F0, T);
+      const IntensityCalculator ls_str =
+          cached ? cached->str[i]
+                 : IntensityCalculator(T, QT, QT0, dQTdT, r, drdSELFVMR, drdT,
+                                       nlte, band, i);
+      const Output X =
+          cached ? cached->X[i] : band.ShapeParameters(i, T, P, vmrs);
+
       // Call cut off loop with or without sparsity
       switch (speedup_type) {
       case Options::LblSpeedup::None:
-        cutoff_loop(com, Normalizer(band.normalization, band.lines[i].F0, T),
-                    IntensityCalculator(T, QT, QT0, dQTdT, r, drdSELFVMR, drdT,
-                                        nlte, band, i),
-                    band, derivs, band.ShapeParameters(i, T, P, vmrs), T, H, DC,
-                    i, zeeman_polarization);
+        cutoff_loop(com, ls_norm, ls_str, band, derivs, X, T, H, DC, i,
+                    zeeman_polarization);
         break;
       case Options::LblSpeedup::QuadraticIndependent:
-        cutoff_loop_sparse_triple(
-            com, sparse_com,
-            Normalizer(band.normalization, band.lines[i].F0, T),
-            IntensityCalculator(T, QT, QT0, dQTdT, r, drdSELFVMR, drdT, nlte,
-                                band, i),
-            band, derivs, band.ShapeParameters(i, T, P, vmrs), T, H, sparse_lim,
-            DC, i, zeeman_polarization);
+        cutoff_loop_sparse_triple(com, sparse_com, ls_norm, ls_str, band,
+                                  derivs, X, T, H, sparse_lim, DC, i,
+                                  zeeman_polarization);
         break;
       case Options::LblSpeedup::LinearIndependent:
-        cutoff_loop_sparse_linear(
-            com, sparse_com,
-            Normalizer(band.normalization, band.lines[i].F0, T),
-            IntensityCalculator(T, QT, QT0, dQTdT, r, drdSELFVMR, drdT, nlte,
-                                band, i),
-            band, derivs, band.ShapeParameters(i, T, P, vmrs), T, H, sparse_lim,
-            DC, i, zeeman_polarization);
+        cutoff_loop_sparse_linear(com, sparse_com, ls_norm, ls_str, band,
+                                  derivs, X, T, H, sparse_lim, DC, i,
+                                  zeeman_polarization);
         break;
       case Options::LblSpeedup::FINAL: { /* Leave last */
       }
@@ -3555,7 +3669,8 @@ void compute(ComputeData &com, ComputeData &sparse_com,
              const Numeric &H, const Numeric &sparse_lim,
              const Zeeman::Polarization zeeman_polarization,
              const Options::LblSpeedup speedup_type,
-             const bool robust) ARTS_NOEXCEPT {
+             const bool robust,
+             const Index cache_size) ARTS_NOEXCEPT {
   [[maybe_unused]] const Index nj = jacobian_quantities.nelem();
   const Index nl = band.NumLines();
   const Index nv = com.f_grid.nelem();
@@ -3571,13 +3686,15 @@ void compute(ComputeData &com, ComputeData &sparse_com,
   ARTS_ASSERT(not com.do_nlte or com.N.size() == nv,
               "N is wrong size.  Size is (", com.N.size(), ") but should be (",
               nv, ')')
-  ARTS_ASSERT(nj == 0 or (com.dF.nrows() == nv and com.dF.ncols() == nj),
+  [[maybe_unused]] const Index nd =
+      ComputeData::derivatives_size(jacobian_quantities);
+  ARTS_ASSERT(nd == 0 or (com.dF.nrows() == nd and com.dF.ncols() == nv),
               "dF is wrong size.  Size is (", com.dF.nrows(), " x ",
-              com.dF.ncols(), ") but should be: (", nv, " x ", nj, ")")
-  ARTS_ASSERT(nj == 0 or not com.do_nlte or
-                  (com.dN.nrows() == nv and com.dN.ncols() == nj),
+              com.dF.ncols(), ") but should be: (", nd, " x ", nv, ")")
+  ARTS_ASSERT(nd == 0 or not com.do_nlte or
+                  (com.dN.nrows() == nd and com.dN.ncols() == nv),
               "dN is wrong size.  Size is (", com.dN.nrows(), " x ",
-              com.dN.ncols(), ") but should be: (", nv, " x ", nj, ")")
+              com.dN.ncols(), ") but should be: (", nd, " x ", nv, ")")
   ARTS_ASSERT((sparse_lim > 0 and sparse_com.f_grid.size() > 1) or
                   (sparse_lim == 0),
               "Sparse limit is either 0, or the sparse frequency grid has to "
@@ -3592,19 +3709,33 @@ void compute(ComputeData &com, ComputeData &sparse_com,
 
   const Numeric dnumdensdVMR = isot_ratio * number_density(P, T);
 
+  // The line parameters of this atmospheric state, if they are cached
+  const std::shared_ptr<const ParameterCache::Entry> cached =
+      (cache_size > 0 and ParameterCache::cacheable(band))
+          ? band.parameter_cache.data().find_or_add(
+                band, vmrs, P, T, self_vmr, isot_ratio, cache_size)
+          : nullptr;
+
+  // Partition functions
+  const Numeric QT =
+      cached ? cached->QT : single_partition_function(T, band.Isotopologue());
+  const Numeric QT0 =
+      cached ? cached->QT0
+             : single_partition_function(band.T0, band.Isotopologue());
+  const Numeric dQTdT =
+      cached ? cached->dQTdT
+             : dsingle_partition_function_dT(T, band.Isotopologue());
+
   if (robust and band.DoLineMixing(P) and band.AnyLinemixing()) {
     ComputeData com_safe(com.f_grid, jacobian_quantities, com.do_nlte);
     ComputeData sparse_com_safe(sparse_com.f_grid, jacobian_quantities,
                                 sparse_com.do_nlte);
 
     line_loop(com_safe, sparse_com_safe, band, jacobian_quantities, nlte, vmrs,
-              self_tag, P, T, H, sparse_lim,
-              single_partition_function(T, band.Isotopologue()),
-              single_partition_function(band.T0, band.Isotopologue()),
-              dsingle_partition_function_dT(T, band.Isotopologue()),
+              self_tag, P, T, H, sparse_lim, QT, QT0, dQTdT,
               self_vmr * dnumdensdVMR, dnumdensdVMR,
               self_vmr * isot_ratio * dnumber_density_dt(P, T),
-              zeeman_polarization, speedup_type);
+              zeeman_polarization, speedup_type, cached.get());
 
     com_safe.enforce_positive_absorption();
     sparse_com_safe.enforce_positive_absorption();
@@ -3613,14 +3744,154 @@ void compute(ComputeData &com, ComputeData &sparse_com,
     sparse_com += sparse_com_safe;
   } else {
     line_loop(com, sparse_com, band, jacobian_quantities, nlte, vmrs, self_tag,
-              P, T, H, sparse_lim,
-              single_partition_function(T, band.Isotopologue()),
-              single_partition_function(band.T0, band.Isotopologue()),
-              dsingle_partition_function_dT(T, band.Isotopologue()),
-              self_vmr * dnumdensdVMR, dnumdensdVMR,
-              self_vmr * isot_ratio * dnumber_density_dt(P, T),
-              zeeman_polarization, speedup_type);
+              P, T, H, sparse_lim, QT, QT0, dQTdT, self_vmr * dnumdensdVMR,
+              dnumdensdVMR, self_vmr * isot_ratio * dnumber_density_dt(P, T),
+              zeeman_polarization, speedup_type, cached.get());
+  }
+}
+
+/** Calls f with every band parameter that a ParameterCache::Entry depends on
+ *
+ * @param[in] band The absorption band
+ * @param[in] f A function taking one Numeric
+ */
+template <typename Function>
+void for_each_cached_band_parameter(const AbsorptionLines &band,
+                                    Function &&f) {
+  const auto as_numeric = [](auto e) {
+    return static_cast<Numeric>(static_cast<Index>(e));
+  };
+
+  f(band.T0);
+  f(band.linemixinglimit);
+  f(as_numeric(band.quantumidentity.isotopologue_index));
+  f(as_numeric(band.population));
+  f(as_numeric(band.normalization));
+  f(as_numeric(band.broadeningspecies.nelem()));
+  for (auto &species : band.broadeningspecies) f(as_numeric(species));
+  f(as_numeric(band.lines.nelem()));
+  for (auto &line : band.lines) {
+    f(line.F0);
+    f(line.I0);
+    f(line.E0);
+    f(as_numeric(line.lineshape.nelem()));
+    for (auto &model : line.lineshape.Data()) {
+      for (auto &param : model.Data()) {
+        f(as_numeric(param.type));
+        f(param.X0);
+        f(param.X1);
+        f(param.X2);
+        f(param.X3);
+      }
+    }
+  }
+}
+
+ParameterCache::Entry::Entry(const AbsorptionLines &band,
+                             const Vector &vmrs_,
+                             const Numeric P_,
+                             const Numeric T_,
+                             const Numeric self_vmr_,
+                             const Numeric isot_ratio_)
+    : T(T_),
+      P(P_),
+      self_vmr(self_vmr_),
+      isot_ratio(isot_ratio_),
+      vmrs(vmrs_),
+      QT(single_partition_function(T, band.Isotopologue())),
+      QT0(single_partition_function(band.T0, band.Isotopologue())),
+      dQTdT(dsingle_partition_function_dT(T, band.Isotopologue())) {
+  const Index nl = band.NumLines();
+  const Numeric dnumdensdVMR = isot_ratio * number_density(P, T);
+  const Numeric r = self_vmr * dnumdensdVMR;
+  const Numeric drdT = self_vmr * isot_ratio * dnumber_density_dt(P, T);
+  const EnergyLevelMap no_nlte{};
+
+  X.reserve(nl);
+  norm.reserve(nl);
+  str.reserve(nl);
+  for (Index i = 0; i < nl; i++) {
+    X.push_back(band.ShapeParameters(i, T, P, vmrs));
+    norm.emplace_back(band.normalization, band.lines[i].F0, T);
+    str.emplace_back(T, QT, QT0, dQTdT, r, dnumdensdVMR, drdT, no_nlte, band,
+                     i);
+  }
+}
+
+bool ParameterCache::Entry::matches(const Vector &vmrs_,
+                                    const Numeric P_,
+                                    const Numeric T_,
+                                    const Numeric self_vmr_,
+                                    const Numeric isot_ratio_) const noexcept {
+  return T == T_ and P == P_ and self_vmr == self_vmr_ and
+         isot_ratio == isot_ratio_ and vmrs.nelem() == vmrs_.nelem() and
+         std::equal(vmrs.begin(), vmrs.end(), vmrs_.begin());
+}
+
+bool ParameterCache::cacheable(const AbsorptionLines &band) noexcept {
+  return not independent_per_broadener(band.lineshapetype) and
+         band.population not_eq Absorption::PopulationType::NLTE and
+         band.population not_eq Absorption::PopulationType::VibTemps;
+}
+
+std::vector<Numeric> ParameterCache::parameters(
+    const AbsorptionLines &band) {
+  std::vector<Numeric> out;
+  for_each_cached_band_parameter(band, [&out](Numeric x) { out.push_back(x); });
+  return out;
+}
+
+bool ParameterCache::made_from(const AbsorptionLines &band) const noexcept {
+  // Compared bitwise, so that NaN parameters are equal
+  std::size_t i = 0;
+  bool same = true;
+  for_each_cached_band_parameter(band, [&](Numeric x) {
+    same = same and i < band_parameters.size() and
+           std::bit_cast<std::uint64_t>(x) ==
+               std::bit_cast<std::uint64_t>(band_parameters[i]);
+    i++;
+  });
+  return same and i == band_parameters.size();
+}
+
+std::shared_ptr<const ParameterCache::Entry> ParameterCache::find_or_add(
+    const AbsorptionLines &band,
+    const Vector &vmrs,
+    const Numeric P,
+    const Numeric T,
+    const Numeric self_vmr,
+    const Numeric isot_ratio,
+    const Index size) {
+  const auto find = [&]() -> std::shared_ptr<const Entry> {
+    const auto pos = std::find_if(entries.begin(), entries.end(), [&](auto &e) {
+      return e->matches(vmrs, P, T, self_vmr, isot_ratio);
+    });
+    if (pos == entries.end() or not made_from(band)) return nullptr;
+    return *pos;
+  };
+
+  {
+    std::shared_lock lock(mtx);
+    if (auto entry = find()) return entry;
   }
+
+  auto entry =
+      std::make_shared<const Entry>(band, vmrs, P, T, self_vmr, isot_ratio);
+
+  std::unique_lock lock(mtx);
+
+  // Another thread may have added the state in the mean time
+  if (auto found = find()) return found;
+
+  // Drop all entries if the band has changed
+  if (not made_from(band)) {
+    entries.clear();
+    band_parameters = parameters(band);
+  }
+
+  entries.insert(entries.begin(), entry);
+  if (static_cast<Index>(entries.size()) > size) entries.resize(size);
+  return entry;
 }
 
 #undef InternalDerivatives
@@ -3703,7 +3974,7 @@ Vector triple_sparse_f_grid(const Vector &f_grid,
 void ComputeData::interp_add_even(const ComputeData &sparse) ARTS_NOEXCEPT {
   const Index nv = f_grid.nelem();
   const Index sparse_nv = sparse.f_grid.nelem();
-  const Index nj = dF.ncols();
+  const Index nj = dF.nrows();
 
   ARTS_ASSERT(do_nlte == sparse.do_nlte, "Must have the same NLTE status")
   ARTS_ASSERT(sparse_nv > 1, "Must have at least two sparse grid-points")
@@ -3732,14 +4003,14 @@ void ComputeData::interp_add_even(const ComputeData &sparse) ARTS_NOEXCEPT {
 
     F[iv] += l0 * sparse.F[sparse_iv] + l1 * sparse.F[sparse_iv + 1];
     for (Index ij = 0; ij < nj; ij++) {
-      dF(iv, ij) +=
-          l0 * sparse.dF(sparse_iv, ij) + l1 * sparse.dF(sparse_iv + 1, ij);
+      dF(ij, iv) +=
+          l0 * sparse.dF(ij, sparse_iv) + l1 * sparse.dF(ij, sparse_iv + 1);
     }
     if (do_nlte) {
       N[iv] += l0 * sparse.N[sparse_iv] + l1 * sparse.N[sparse_iv + 1];
       for (Index ij = 0; ij < nj; ij++) {
-        dN(iv, ij) +=
-            l0 * sparse.dN(sparse_iv, ij) + l1 * sparse.dN(sparse_iv + 1, ij);
+        dN(ij, iv) +=
+            l0 * sparse.dN(ij, sparse_iv) + l1 * sparse.dN(ij, sparse_iv + 1);
       }
     }
   }
@@ -3749,7 +4020,7 @@ void ComputeData::interp_add_triplequad(const ComputeData &sparse)
     ARTS_NOEXCEPT {
   const Index nv = f_grid.nelem();
   const Index sparse_nv = sparse.f_grid.nelem();
-  const Index nj = dF.ncols();
+  const Index nj = dF.nrows();
 
   ARTS_ASSERT(do_nlte == sparse.do_nlte, "Must have the same NLTE status")
   ARTS_ASSERT(sparse_nv > 2, "Must have at least three sparse grid-points")
@@ -3792,19 +4063,26 @@ void ComputeData::interp_add_triplequad(const ComputeData &sparse)
     F[iv] += l0 * sparse.F[sparse_iv] + l1 * sparse.F[sparse_iv + 1] +
              l2 * sparse.F[sparse_iv + 2];
     for (Index ij = 0; ij < nj; ij++) {
-      dF(iv, ij) += l0 * sparse.dF(sparse_iv, ij) +
-                    l1 * sparse.dF(sparse_iv + 1, ij) +
-                    l2 * sparse.dF(sparse_iv + 2, ij);
+      dF(ij, iv) += l0 * sparse.dF(ij, sparse_iv) +
+                    l1 * sparse.dF(ij, sparse_iv + 1) +
+                    l2 * sparse.dF(ij, sparse_iv + 2);
     }
     if (do_nlte) {
       N[iv] += l0 * sparse.N[sparse_iv] + l1 * sparse.N[sparse_iv + 1] +
                l2 * sparse.N[sparse_iv + 2];
       for (Index ij = 0; ij < nj; ij++) {
-        dN(iv, ij) += l0 * sparse.dN(sparse_iv, ij) +
-                      l1 * sparse.dN(sparse_iv + 1, ij) +
-                      l2 * sparse.dN(sparse_iv + 2, ij);
+        dN(ij, iv) += l0 * sparse.dN(ij, sparse_iv) +
+                      l1 * sparse.dN(ij, sparse_iv + 1) +
+                      l2 * sparse.dN(ij, sparse_iv + 2);
       }
     }
   }
 }
 } // namespace LineShape
+
+LineShape::ParameterCache &Absorption::ParameterCacheHolder::data() const {
+  std::call_once(init, [this] {
+    cache = std::make_shared<LineShape::ParameterCache>();
+  });
+  return *cache;
+}
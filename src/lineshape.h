@@ -1,8 +1,13 @@
 #ifndef lineshapes_h
 #define lineshapes_h
 
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <shared_mutex>
 #include <string_view>
 #include <variant>
+#include <vector>
 
 #include "arts_conversions.h"
 #include "energylevelmap.h"
@@ -699,6 +704,9 @@ class Calculator {
     return std::visit([](auto &&S) { return S.name; }, ls);
   }
 
+  /** The line shape model, to resolve its type outside of frequency loops */
+  [[nodiscard]] constexpr const Variant &data() const noexcept { return ls; }
+
   //! Call operator on frequency.  Must call this before any of the derivatives
   Complex operator()(Numeric f) noexcept;
 
@@ -734,6 +742,11 @@ class Normalizer {
 
   [[nodiscard]] Numeric operator()(Numeric f) noexcept;
 
+  /** The normalization model, to resolve its type outside of frequency loops */
+  [[nodiscard]] constexpr const Variant &data() const noexcept {
+    return ls_norm;
+  }
+
   Normalizer(const Absorption::NormalizationType type,
              const Numeric F0,
              const Numeric T) noexcept;
@@ -836,7 +849,93 @@ class IntensityCalculator {
                                         Species::Species other) noexcept;
 };  // IntensityCalculator
 
-/** Main computational data for the line shape and strength calculations */
+/** Cache of the line parameters of a band for recent atmospheric states
+ *
+ * Keeps the line shape parameters, the normalization, and the line strength
+ * of every line for the most recently added atmospheric states, so that
+ * repeated calculations for the same atmosphere skip their evaluation.  A
+ * copy of the band parameters that the entries were made from is kept and
+ * compared exactly on every lookup, so that the entries are never used for
+ * a band that has been changed in place, and are dropped when a new entry
+ * is added for the changed band.
+ *
+ * Only bands with line strengths that do not depend on NLTE data and with
+ * line shape parameters that are combined over the broadeners are cached.
+ */
+struct ParameterCache {
+  //! The line parameters of a band at an atmospheric state
+  struct Entry {
+    Numeric T;
+    Numeric P;
+    Numeric self_vmr;
+    Numeric isot_ratio;
+    Vector vmrs;
+
+    Numeric QT;
+    Numeric QT0;
+    Numeric dQTdT;
+    std::vector<Output> X;
+    std::vector<Normalizer> norm;
+    std::vector<IntensityCalculator> str;
+
+    Entry(const AbsorptionLines &band,
+          const Vector &vmrs,
+          Numeric P,
+          Numeric T,
+          Numeric self_vmr,
+          Numeric isot_ratio);
+
+    [[nodiscard]] bool matches(const Vector &vmrs,
+                               Numeric P,
+                               Numeric T,
+                               Numeric self_vmr,
+                               Numeric isot_ratio) const noexcept;
+  };
+
+  //! The band parameters that the entries were computed from
+  std::vector<Numeric> band_parameters;
+
+  //! The entries, most recently added first
+  std::vector<std::shared_ptr<const Entry>> entries;
+
+  //! Shared for finding entries, unique for adding them
+  std::shared_mutex mtx;
+
+  /** Every band parameter that the entries depend on */
+  static std::vector<Numeric> parameters(const AbsorptionLines &band);
+
+  /** Whether or not the entries were made from these band parameters */
+  [[nodiscard]] bool made_from(const AbsorptionLines &band) const noexcept;
+
+  /** Whether or not the parameters of this band can be cached */
+  static bool cacheable(const AbsorptionLines &band) noexcept;
+
+  /** Finds the entry of this state, computing it if it is not cached
+   *
+   * @param[in] band The absorption band that owns this cache
+   * @param[in] vmrs The volume mixing ratios of the band's line shape model
+   * @param[in] P The atmospheric pressure
+   * @param[in] T The atmospheric temperature
+   * @param[in] self_vmr The volume mixing of the band's species
+   * @param[in] isot_ratio The isotopologue ratio of the band's species
+   * @param[in] size The maximum number of states to keep
+   * @return The line parameters of this state
+   */
+  std::shared_ptr<const Entry> find_or_add(const AbsorptionLines &band,
+                                           const Vector &vmrs,
+                                           Numeric P,
+                                           Numeric T,
+                                           Numeric self_vmr,
+                                           Numeric isot_ratio,
+                                           Index size);
+};
+
+/** Main computational data for the line shape and strength calculations
+ *
+ * The derivatives are kept as one contiguous frequency array per Jacobian
+ * quantity, dF(ij, iv) and dN(ij, iv).  They are not allocated at all if
+ * none of the Jacobian quantities is of propagation matrix type.
+ */
 struct ComputeData {
   ComplexVector F, N;
   ComplexMatrix dF, dN;
@@ -848,11 +947,23 @@ struct ComputeData {
               const bool nlte) noexcept
       : F(f.nelem(), 0),
         N(nlte ? f.nelem() : 0, 0),
-        dF(f.nelem(), jacobian_quantities.nelem(), 0),
-        dN(nlte ? f.nelem() : 0, nlte ? jacobian_quantities.nelem() : 0, 0),
+        dF(derivatives_size(jacobian_quantities), f.nelem(), 0),
+        dN(nlte ? derivatives_size(jacobian_quantities) : 0,
+           nlte ? f.nelem() : 0,
+           0),
         f_grid(f),
         do_nlte(nlte) {}
 
+  /** The number of derivatives to allocate for these Jacobian quantities */
+  static Index derivatives_size(
+      const ArrayOfRetrievalQuantity &jacobian_quantities) noexcept {
+    return std::any_of(jacobian_quantities.begin(),
+                       jacobian_quantities.end(),
+                       [](auto &deriv) { return deriv.propmattype(); })
+               ? jacobian_quantities.nelem()
+               : 0;
+  }
+
   void reset() noexcept {
     F = 0;
     N = 0;
@@ -878,10 +989,10 @@ struct ComputeData {
     for (Index i = 0; i < nf; i++) {
       if (F[i].real() < 0) {
         F[i] = 0;
-        dF(i, joker) = 0;
+        dF(joker, i) = 0;
         if (do_nlte) {
           N[i] = 0;
-          dN(i, joker) = 0;
+          dN(joker, i) = 0;
         }
       }
     }
@@ -935,6 +1046,7 @@ struct ComputeData {
  * @param[in] zeeman_polarization Type of Zeeman polarization
  * @param[in] speedup_type Type of sparse grid interactions
  * @param[in] robust If true, a band with line mixing parameters guarantees non-negative output by allocating its own com and sparse_com for local calculations
+ * @param[in] cache_size The number of atmospheric states to keep in the ParameterCache of the band, 0 for no caching
  */
 void compute(ComputeData &com,
              ComputeData &sparse_com,
@@ -951,7 +1063,8 @@ void compute(ComputeData &com,
              const Numeric &sparse_lim,
              const Zeeman::Polarization zeeman_polarization,
              const Options::LblSpeedup speedup_type,
-             const bool robust) ARTS_NOEXCEPT;
+             const bool robust,
+             const Index cache_size = 0) ARTS_NOEXCEPT;
 
 Vector linear_sparse_f_grid(const Vector &f_grid,
                             const Numeric &sparse_df) ARTS_NOEXCEPT;
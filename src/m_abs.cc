@@ -396,6 +396,105 @@ void propmat_clearskyInit(  //WS Output
   }
 }
 
+/* Workspace method: Doxygen documentation will be auto-generated */
+void ppvar_propmatInit(  //WS Output
+    ArrayOfPropagationMatrix& ppvar_propmat,
+    ArrayOfStokesVector& ppvar_nlte_source,
+    ArrayOfArrayOfPropagationMatrix& ppvar_dpropmat,
+    ArrayOfArrayOfStokesVector& ppvar_dnlte_source,
+    //WS Input
+    const ArrayOfRetrievalQuantity& jacobian_quantities,
+    const Matrix& ppvar_f,
+    const Index& stokes_dim,
+    const Verbosity&) {
+  const Index nf = ppvar_f.nrows();
+  const Index np = ppvar_f.ncols();
+  const Index nq = jacobian_quantities.nelem();
+
+  ARTS_USER_ERROR_IF(not nf, "No frequencies");
+
+  ARTS_USER_ERROR_IF(stokes_dim < 1 or stokes_dim > 4,
+                     "stokes_dim not in [1, 2, 3, 4]");
+
+  ppvar_propmat = ArrayOfPropagationMatrix(np, PropagationMatrix(nf, stokes_dim));
+  ppvar_nlte_source = ArrayOfStokesVector(np, StokesVector(nf, stokes_dim));
+  ppvar_dpropmat = ArrayOfArrayOfPropagationMatrix(
+      np, ArrayOfPropagationMatrix(nq, PropagationMatrix(nf, stokes_dim)));
+  ppvar_dnlte_source = ArrayOfArrayOfStokesVector(
+      np, ArrayOfStokesVector(nq, StokesVector(nf, stokes_dim)));
+}
+
+/* Workspace method: Doxygen documentation will be auto-generated */
+void ppvar_propmatCalc(Workspace& ws,
+                       //WS Output
+                       ArrayOfPropagationMatrix& ppvar_propmat,
+                       ArrayOfStokesVector& ppvar_nlte_source,
+                       ArrayOfArrayOfPropagationMatrix& ppvar_dpropmat,
+                       ArrayOfArrayOfStokesVector& ppvar_dnlte_source,
+                       //WS Input
+                       const Agenda& propmat_clearsky_agenda,
+                       const ArrayOfRetrievalQuantity& jacobian_quantities,
+                       const Matrix& ppvar_f,
+                       const Matrix& ppvar_mag,
+                       const Ppath& ppath,
+                       const Vector& ppvar_p,
+                       const Vector& ppvar_t,
+                       const EnergyLevelMap& ppvar_nlte,
+                       const Matrix& ppvar_vmr,
+                       const Verbosity&) {
+  const Index np = ppvar_p.nelem();
+
+  ARTS_USER_ERROR_IF(ppvar_t.nelem() not_eq np or ppvar_f.ncols() not_eq np or
+                         ppvar_mag.ncols() not_eq np or
+                         ppvar_vmr.ncols() not_eq np or ppath.np not_eq np,
+                     "The ppvar-variables and *ppath* must have the same "
+                     "number of points")
+
+  ppvar_propmat.resize(np);
+  ppvar_nlte_source.resize(np);
+  ppvar_dpropmat.resize(np);
+  ppvar_dnlte_source.resize(np);
+
+  ArrayOfString fail_msg;
+  bool do_abort = false;
+
+  WorkspaceOmpParallelCopyGuard wss{ws};
+
+#pragma omp parallel for if (!arts_omp_in_parallel()) firstprivate(wss)
+  for (Index ip = 0; ip < np; ip++) {
+    if (do_abort) continue;
+    try {
+      propmat_clearsky_agendaExecute(wss,
+                                     ppvar_propmat[ip],
+                                     ppvar_nlte_source[ip],
+                                     ppvar_dpropmat[ip],
+                                     ppvar_dnlte_source[ip],
+                                     jacobian_quantities,
+                                     {},
+                                     Vector{ppvar_f(joker, ip)},
+                                     Vector{ppvar_mag(joker, ip)},
+                                     Vector{ppath.los(ip, joker)},
+                                     ppvar_p[ip],
+                                     ppvar_t[ip],
+                                     ppvar_nlte[ip],
+                                     Vector{ppvar_vmr(joker, ip)},
+                                     propmat_clearsky_agenda);
+    } catch (const std::exception& e) {
+#pragma omp critical(ppvar_propmatCalc_fail)
+      {
+        do_abort = true;
+        fail_msg.push_back(var_string(
+            "Runtime-error in propagation matrix calculation at index ",
+            ip,
+            ": \n",
+            e.what()));
+      }
+    }
+  }
+
+  ARTS_USER_ERROR_IF(do_abort, "Error messages from failed cases:\n", fail_msg)
+}
+
 /* Workspace method: Doxygen documentation will be auto-generated */
 void propmat_clearskyAddFaraday(
     PropagationMatrix& propmat_clearsky,
@@ -817,6 +916,30 @@ Vector create_sparse_f_grid_internal(const Vector& f_grid,
   return sparse_f_grid;
 }
 
+/** Number of frequency parts for line-by-line calculations in parallel
+ *
+ * Every part of the frequency grid is computed by a single thread for all
+ * bands, so that no thread needs a copy of the full grid.  The per-line setup
+ * is repeated for every part, so the parts are kept reasonably large.  A few
+ * more parts than threads are used to balance bands with cutoffs.
+ *
+ * @param[in] nf The number of frequencies
+ * @param[in] speedup_type The sparse grid speedup
+ * @return The number of parts, or 0 if the bands should be parallelized instead
+ */
+Index lbl_frequency_parts(const Index nf,
+                          const Options::LblSpeedup speedup_type) {
+  constexpr Index min_part_size = 256;
+  const Index nthreads = arts_omp_get_max_threads();
+  const Index nparts = std::min(4 * nthreads, nf / min_part_size);
+
+  // The sparse grid ranges depend on the full sparse grid, so they cannot be
+  // split up
+  if (speedup_type not_eq Options::LblSpeedup::None or nparts < nthreads)
+    return 0;
+  return nparts;
+}
+
 /* Workspace method: Doxygen documentation will be auto-generated */
 void propmat_clearskyAddLines(  // Workspace reference:
     // WS Output:
@@ -837,6 +960,7 @@ void propmat_clearskyAddLines(  // Workspace reference:
     const Vector& rtp_vmr,
     const Index& nlte_do,
     const Index& lbl_checked,
+    const Index& lbl_cache_size,
     // WS User Generic inputs
     const Numeric& sparse_df,
     const Numeric& sparse_lim,
@@ -851,6 +975,7 @@ void propmat_clearskyAddLines(  // Workspace reference:
 
   // Possible things that can go wrong in this code (excluding line parameters)
   ARTS_USER_ERROR_IF(not lbl_checked, "Must check LBL calculations")
+  ARTS_USER_ERROR_IF(lbl_cache_size < 0, "Negative *lbl_cache_size*")
   check_abs_species(abs_species);
   ARTS_USER_ERROR_IF(rtp_vmr.nelem() not_eq abs_species.nelem(),
                      "*rtp_vmr* must match *abs_species*")
@@ -906,7 +1031,7 @@ void propmat_clearskyAddLines(  // Workspace reference:
   LineShape::ComputeData sparse_com(
       f_grid_sparse, jacobian_quantities, nlte_do);
 
-  if (arts_omp_in_parallel()) {
+  if (arts_omp_in_parallel() or arts_omp_get_max_threads() == 1) {
     for (Index ispecies = 0; ispecies < ns; ispecies++) {
       if (select_abs_species.nelem() and
           select_abs_species not_eq abs_species[ispecies])
@@ -933,10 +1058,65 @@ void propmat_clearskyAddLines(  // Workspace reference:
                           sparse_lim,
                           Zeeman::Polarization::None,
                           speedup_type,
-                          robust not_eq 0);
+                          robust not_eq 0,
+                          lbl_cache_size);
+      }
+    }
+  } else if (const Index nparts = lbl_frequency_parts(nf, speedup_type);
+             nparts > 0) {  // In parallel over frequency
+    const Vector f_grid_part_sparse(0);
+
+#pragma omp parallel for schedule(dynamic)
+    for (Index ipart = 0; ipart < nparts; ipart++) {
+      const Index f0 = ipart * nf / nparts;
+      const Range part(f0, (ipart + 1) * nf / nparts - f0);
+      const Vector f_grid_part{f_grid[part]};
+      LineShape::ComputeData com_part(
+          f_grid_part, jacobian_quantities, static_cast<bool>(nlte_do));
+      LineShape::ComputeData sparse_com_part(
+          f_grid_part_sparse, jacobian_quantities, static_cast<bool>(nlte_do));
+
+      for (Index ispecies = 0; ispecies < ns; ispecies++) {
+        if (select_abs_species.nelem() and
+            select_abs_species not_eq abs_species[ispecies])
+          continue;
+
+        // Skip it if there are no species or there is Zeeman requested
+        if (not abs_species[ispecies].nelem() or
+            abs_species[ispecies].Zeeman() or
+            not abs_lines_per_species[ispecies].nelem())
+          continue;
+
+        for (auto& band : abs_lines_per_species[ispecies]) {
+          LineShape::compute(com_part,
+                             sparse_com_part,
+                             band,
+                             jacobian_quantities,
+                             rtp_nlte,
+                             band.BroadeningSpeciesVMR(rtp_vmr, abs_species),
+                             abs_species[ispecies],
+                             rtp_vmr[ispecies],
+                             isotopologue_ratios[band.Isotopologue()],
+                             rtp_pressure,
+                             rtp_temperature,
+                             0,
+                             sparse_lim,
+                             Zeeman::Polarization::None,
+                             speedup_type,
+                             robust not_eq 0,
+                             lbl_cache_size);
+        }
+      }
+
+      // The parts are disjoint so they are copied rather than summed
+      com.F[part] = com_part.F;
+      com.dF(joker, part) = com_part.dF;
+      if (nlte_do) {
+        com.N[part] = com_part.N;
+        com.dN(joker, part) = com_part.dN;
       }
     }
-  } else {  // In parallel
+  } else {  // In parallel over bands
     const Index nbands = [](auto& lines) {
       Index n = 0;
       for (auto& abs_lines : lines) n += abs_lines.nelem();
@@ -982,7 +1162,8 @@ void propmat_clearskyAddLines(  // Workspace reference:
                          sparse_lim,
                          Zeeman::Polarization::None,
                          speedup_type,
-                         robust not_eq 0);
+                         robust not_eq 0,
+                         lbl_cache_size);
     }
 
     for (auto& pcom: vcom) com += pcom;
@@ -1008,7 +1189,7 @@ void propmat_clearskyAddLines(  // Workspace reference:
   // Sum up the Jacobian
   for (Index j = 0; j < nq; j++) {
     if (not jacobian_quantities[j].propmattype()) continue;
-    dpropmat_clearsky_dx[j].Kjj() += com.dF.real()(joker, j);
+    dpropmat_clearsky_dx[j].Kjj() += com.dF.real()(j, joker);
   }
 
   if (nlte_do) {
@@ -1018,7 +1199,7 @@ void propmat_clearskyAddLines(  // Workspace reference:
     // Sum up the Jacobian
     for (Index j = 0; j < nq; j++) {
       if (not jacobian_quantities[j].propmattype()) continue;
-      dnlte_source_dx[j].Kjj() += com.dN.real()(joker, j);
+      dnlte_source_dx[j].Kjj() += com.dN.real()(j, joker);
     }
   }
 }
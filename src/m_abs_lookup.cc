@@ -225,6 +225,9 @@ Your current lowest_vmr value is: )--", lowest_vmr)
 
     abs_lookup.xsec.resize(a, b, c, d);
     abs_lookup.xsec = NAN;
+
+    // A previous table may have been stored in reduced precision
+    abs_lookup.xsec_compact = CompactCrossSections{};
   }
 
   // 6.a. Set up these_t_pert. This is done so that we can use the
@@ -1984,6 +1987,19 @@ void abs_lookupAdapt(GasAbsLookup& abs_lookup,
   abs_lookup_is_adapted = 1;
 }
 
+/* Workspace method: Doxygen documentation will be auto-generated */
+void abs_lookupSetStorage(GasAbsLookup& abs_lookup,
+                          const String& storage,
+                          const Verbosity& verbosity) {
+  CREATE_OUT2;
+
+  const Numeric max_rel_error =
+      abs_lookup.SetStorage(toGasAbsLookupStorageOrThrow(storage));
+
+  out2 << "  Largest relative error of the \"" << storage
+       << "\" cross sections: " << max_rel_error << "\n";
+}
+
 /* Workspace method: Doxygen documentation will be auto-generated */
 void propmat_clearskyAddFromLookup(
     PropagationMatrix& propmat_clearsky,
@@ -2117,6 +2133,145 @@ void propmat_clearskyAddFromLookup(
   }
 }
 
+/* Workspace method: Doxygen documentation will be auto-generated */
+void ppvar_propmatAddFromLookup(
+    ArrayOfPropagationMatrix& ppvar_propmat,
+    ArrayOfArrayOfPropagationMatrix& ppvar_dpropmat,
+    const GasAbsLookup& abs_lookup,
+    const Index& abs_lookup_is_adapted,
+    const Index& abs_p_interp_order,
+    const Index& abs_t_interp_order,
+    const Index& abs_nls_interp_order,
+    const Index& abs_f_interp_order,
+    const Matrix& ppvar_f,
+    const Vector& ppvar_p,
+    const Vector& ppvar_t,
+    const Matrix& ppvar_vmr,
+    const ArrayOfRetrievalQuantity& jacobian_quantities,
+    const ArrayOfArrayOfSpeciesTag& abs_species,
+    const Numeric& extpolfac,
+    const Index& no_negatives,
+    const Verbosity&) {
+  const Index nf = ppvar_f.nrows();
+  const Index np = ppvar_p.nelem();
+
+  ARTS_USER_ERROR_IF(1 != abs_lookup_is_adapted,
+                     "Gas absorption lookup table must be adapted,\n"
+                     "use method abs_lookupAdapt.")
+
+  ARTS_USER_ERROR_IF(ppvar_propmat.nelem() not_eq np or
+                         ppvar_dpropmat.nelem() not_eq np or
+                         ppvar_t.nelem() not_eq np or
+                         ppvar_f.ncols() not_eq np or
+                         ppvar_vmr.ncols() not_eq np,
+                     "The ppvar-variables must have the same number of points.\n"
+                     "Did you forget to call *ppvar_propmatInit*?")
+
+  const bool do_jac = supports_lookup(jacobian_quantities);
+  const bool do_freq_jac = do_frequency_jacobian(jacobian_quantities);
+  const bool do_temp_jac = do_temperature_jacobian(jacobian_quantities);
+  const Numeric df = frequency_perturbation(jacobian_quantities);
+  const Numeric dt = temperature_perturbation(jacobian_quantities);
+
+  // See propmat_clearskyAddFromLookup
+  ARTS_USER_ERROR_IF(do_freq_jac and (1 > abs_f_interp_order),
+                     "Wind/frequency Jacobian is not possible without at least first\n"
+                     "order frequency interpolation in the lookup table.  Please use\n"
+                     "abs_f_interp_order>0 or remove wind/frequency Jacobian.")
+
+  // All points share one frequency grid unless there is a Doppler shift
+  bool same_f_grid = true;
+  for (Index ip = 1; ip < np and same_f_grid; ip++)
+    for (Index iv = 0; iv < nf and same_f_grid; iv++)
+      same_f_grid = ppvar_f(iv, ip) == ppvar_f(iv, 0);
+
+  // Absorption of all points as [np, nspecies, nf]
+  const auto extract = [&](Tensor3& sga, const Vector& T, const Numeric f_shift) {
+    if (same_f_grid) {
+      Vector f_grid{ppvar_f(joker, 0)};
+      f_grid += f_shift;
+      abs_lookup.Extract(sga,
+                         {},
+                         abs_p_interp_order,
+                         abs_t_interp_order,
+                         abs_nls_interp_order,
+                         abs_f_interp_order,
+                         ppvar_p,
+                         T,
+                         ppvar_vmr,
+                         f_grid,
+                         extpolfac);
+    } else {
+      Matrix sga_point;
+      for (Index ip = 0; ip < np; ip++) {
+        Vector f_grid{ppvar_f(joker, ip)};
+        f_grid += f_shift;
+        abs_lookup.Extract(sga_point,
+                           {},
+                           abs_p_interp_order,
+                           abs_t_interp_order,
+                           abs_nls_interp_order,
+                           abs_f_interp_order,
+                           ppvar_p[ip],
+                           T[ip],
+                           ppvar_vmr(joker, ip),
+                           f_grid,
+                           extpolfac);
+        if (ip == 0) sga.resize(np, sga_point.nrows(), sga_point.ncols());
+        sga(ip, joker, joker) = sga_point;
+      }
+    }
+  };
+
+  Tensor3 abs_scalar_gas, dabs_scalar_gas_df, dabs_scalar_gas_dt;
+  extract(abs_scalar_gas, ppvar_t, 0);
+  if (do_freq_jac) extract(dabs_scalar_gas_df, ppvar_t, df);
+  if (do_temp_jac) {
+    Vector dtemp = ppvar_t;
+    dtemp += dt;
+    extract(dabs_scalar_gas_dt, dtemp, 0);
+  }
+
+  if (no_negatives) {
+    //Check for negative values due to interpolation and set them to zero
+    std::replace_if(abs_scalar_gas.elem_begin(),
+                    abs_scalar_gas.elem_end(),
+                    [](Numeric x) { return x < 0; },
+                    0.0);
+  }
+
+  // Now add to the right place in the absorption matrices
+  for (Index ip = 0; ip < np; ip++) {
+    for (Index isp = 0; isp < abs_scalar_gas.nrows(); isp++) {
+      ppvar_propmat[ip].Kjj() += abs_scalar_gas(ip, isp, joker);
+
+      if (not do_jac) continue;
+
+      for (Index iv = 0; iv < nf; iv++) {
+        for (Index iq = 0; iq < jacobian_quantities.nelem(); iq++) {
+          const auto& deriv = jacobian_quantities[iq];
+
+          if (not deriv.propmattype()) continue;
+
+          if (deriv == Jacobian::Atm::Temperature) {
+            ppvar_dpropmat[ip][iq].Kjj()[iv] +=
+                (dabs_scalar_gas_dt(ip, isp, iv) - abs_scalar_gas(ip, isp, iv)) / dt;
+          } else if (is_frequency_parameter(deriv)) {
+            ppvar_dpropmat[ip][iq].Kjj()[iv] +=
+                (dabs_scalar_gas_df(ip, isp, iv) - abs_scalar_gas(ip, isp, iv)) / df;
+          } else if (deriv == abs_species[isp]) {
+            // WARNING:  If CIA in list, this scales wrong by factor 2
+            ppvar_dpropmat[ip][iq].Kjj()[iv] +=
+                (std::isnormal(ppvar_vmr(isp, ip)))
+                    ? abs_scalar_gas(ip, isp, iv) / ppvar_vmr(isp, ip)
+                    : 0;
+          }
+        }
+      }
+    }
+  }
+}
+
 /* Workspace method: Doxygen documentation will be auto-generated */
 void propmat_clearsky_fieldCalc(Workspace& ws,
                                 // WS Output:
@@ -55,6 +55,13 @@ void ppath_step_agendaSet(Workspace& ws,
   out = get_ppath_step_agenda(ws, option);
 }
 
+void ppvar_propmat_agendaSet(Workspace& ws,
+                             Agenda& out,
+                             const String& option,
+                             const Verbosity&) {
+  out = get_ppvar_propmat_agenda(ws, option);
+}
+
 void refr_index_air_agendaSet(Workspace& ws,
                               Agenda& out,
                               const String& option,
@@ -468,6 +468,7 @@ void cloudbox_field_monoIterate(Workspace& ws,
                                 const Agenda& doit_rte_agenda,
                                 const Agenda& doit_conv_test_agenda,
                                 const Index& accelerated,
+                                const Index& anderson_depth,
                                 const Verbosity& verbosity)
 
 {
@@ -478,6 +479,11 @@ void cloudbox_field_monoIterate(Workspace& ws,
   chk_not_empty("doit_rte_agenda", doit_rte_agenda);
   chk_not_empty("doit_conv_test_agenda", doit_conv_test_agenda);
 
+  ARTS_USER_ERROR_IF(anderson_depth < 0, "*anderson_depth* must be >= 0.");
+  ARTS_USER_ERROR_IF(accelerated > 0 and anderson_depth > 0,
+                     "Ng-Acceleration (*accelerated*) and Anderson "
+                     "acceleration (*anderson_depth*) can not be combined.");
+
   for (Index v = 0; v < cloudbox_field_mono.nvitrines(); v++)
     for (Index s = 0; s < cloudbox_field_mono.nshelves(); s++)
       for (Index b = 0; b < cloudbox_field_mono.nbooks(); b++)
@@ -497,6 +503,9 @@ void cloudbox_field_monoIterate(Workspace& ws,
   Index doit_conv_flag_local;
   Index doit_iteration_counter_local;
 
+  // Lets doit_rte_agenda keep what stays fixed between the iterations
+  DoitRteCache doit_rte_cache;
+
   // Resize and initialize doit_scat_field,
   // which  has the same dimensions as cloudbox_field
   Tensor6 doit_scat_field_local(cloudbox_field_mono.nvitrines(),
@@ -514,6 +523,8 @@ void cloudbox_field_monoIterate(Workspace& ws,
   if (accelerated) {
     acceleration_input.resize(4);
   }
+  // Fields the last iterations started from and resulted in
+  ArrayOfTensor6 anderson_input, anderson_output;
   while (doit_conv_flag_local == 0) {
     // 1. Copy cloudbox_field to cloudbox_field_old.
     cloudbox_field_mono_old_local = cloudbox_field_mono;
@@ -548,6 +559,16 @@ void cloudbox_field_monoIterate(Workspace& ws,
             cloudbox_field_mono, acceleration_input, accelerated, verbosity);
       }
     }
+
+    // Anderson acceleration, if wished.
+    if (anderson_depth > 0 && doit_conv_flag_local == 0) {
+      cloudbox_field_andersonUpdate(cloudbox_field_mono,
+                                    anderson_input,
+                                    anderson_output,
+                                    std::move(cloudbox_field_mono_old_local),
+                                    anderson_depth,
+                                    verbosity);
+    }
   }  //end of while loop, convergence is reached.
 }
 
@@ -889,21 +910,31 @@ void cloudbox_fieldUpdateSeq1D(
                              verbosity);
   }
 
+  // Reuse the fixed parts of the radiative transfer steps from earlier
+  // iterations if cloudbox_field_monoIterate keeps them
+  DoitRteCache* rte_cache = DoitRteCache::current();
+  if (rte_cache)
+    rte_cache->prepare(f_grid[f_index], cloudbox_limits, za_grid, stokes_dim);
+
   //Loop over all directions, defined by za_grid
   for (Index za_index_local = 0; za_index_local < N_scat_za; za_index_local++) {
+    // The particle properties are only needed to calculate the steps
+    const bool rte_cached = rte_cache and rte_cache->done(za_index_local);
+
     // This function has to be called inside the angular loop, as
     // spt_calc_agenda takes *za_index* and *aa_index*
     // from the workspace.
-    cloud_fieldsCalc(ws,
-                     ext_mat_field,
-                     abs_vec_field,
-                     spt_calc_agenda,
-                     za_index_local,
-                     aa_index_local,
-                     cloudbox_limits,
-                     t_field,
-                     pnd_field,
-                     verbosity);
+    if (not rte_cached)
+      cloud_fieldsCalc(ws,
+                       ext_mat_field,
+                       abs_vec_field,
+                       spt_calc_agenda,
+                       za_index_local,
+                       aa_index_local,
+                       cloudbox_limits,
+                       t_field,
+                       pnd_field,
+                       verbosity);
 
     //======================================================================
     // Radiative transfer inside the cloudbox
@@ -941,7 +972,9 @@ void cloudbox_fieldUpdateSeq1D(
                              abs_vec_field,
                              surface_rtprop_agenda,
                              doit_za_interp,
-                             verbosity);
+                             verbosity,
+                             rte_cache ? &rte_cache->step(p_index, za_index_local)
+                                       : nullptr);
       }
     } else if (za_grid[za_index_local] >= theta_lim) {
       //
@@ -972,7 +1005,9 @@ void cloudbox_fieldUpdateSeq1D(
                              abs_vec_field,
                              surface_rtprop_agenda,
                              doit_za_interp,
-                             verbosity);
+                             verbosity,
+                             rte_cache ? &rte_cache->step(p_index, za_index_local)
+                                       : nullptr);
       }  // Close loop over p_grid (inside cloudbox).
     }    // end if downlooking.
 
@@ -1019,7 +1054,10 @@ void cloudbox_fieldUpdateSeq1D(
                                  abs_vec_field,
                                  surface_rtprop_agenda,
                                  doit_za_interp,
-                                 verbosity);
+                                 verbosity,
+                                 rte_cache
+                                     ? &rte_cache->step(p_index, za_index_local)
+                                     : nullptr);
           }
         }
 
@@ -1047,6 +1085,8 @@ void cloudbox_fieldUpdateSeq1D(
       }
       out2 << "Limb iterations: " << limb_it << "\n";
     }
+
+    if (rte_cache) rte_cache->set_done(za_index_local);
   }  // Closes loop over za_grid.
 }  // End of the function.
 
@@ -2150,56 +2190,27 @@ void doit_scat_fieldCalc(Workspace& ws,
   out2 << "  Calculate the scattered field\n";
 
   if (atmosphere_dim == 1) {
-    // Get pha_mat at the grid positions
-    // Since atmosphere_dim = 1, there is no loop over lat and lon grids
-    for (Index p_index = 0; p_index <= cloudbox_limits[1] - cloudbox_limits[0];
-         p_index++) {
-      //There is only loop over zenith angle grid ; no azimuth angle grid.
-      for (Index za_index_local = 0; za_index_local < Nza; za_index_local++) {
-        // Calculate the phase matrix of individual scattering elements
-        out3 << "Multiplication of phase matrix with incoming"
-             << " intensities \n";
-
-        product_field = 0;
-
-        // za_in and aa_in are for incoming zenith and azimuth
-        //angle direction for which pha_mat is calculated
-        for (Index za_in = 0; za_in < Nza; ++za_in) {
-          for (Index aa_in = 0; aa_in < Naa; ++aa_in) {
-            // Multiplication of phase matrix with incoming
-            // intensity field.
-
-            for (Index i = 0; i < stokes_dim; i++) {
-              for (Index j = 0; j < stokes_dim; j++) {
-                product_field(za_in, aa_in, i) +=
-                    pha_mat_doit(
-                        p_index, za_index_local, 0, za_in, aa_in, i, j) *
-                    cloudbox_field_mono(p_index, 0, 0, za_in, 0, j);
-              }
-            }
-
-          }  //end aa_in loop
-        }    //end za_in loop
-        //integration of the product of ifield_in and pha
-        //  over zenith angle and azimuth angle grid. It calls
-        if (Naa == 1) {
-          for (Index i = 0; i < stokes_dim; i++) {
-            doit_scat_field(p_index, 0, 0, za_index_local, 0, i) =
-                AngIntegrate_trapezoid(product_field(joker, 0, i), za_grid) /
-                2 / PI;
-          }  //end i loop
-        } else {
-          for (Index i = 0; i < stokes_dim; i++) {
-            doit_scat_field(p_index, 0, 0, za_index_local, 0, i) =
-                AngIntegrate_trapezoid_opti(product_field(joker, joker, i),
-                                            za_grid,
-                                            aa_grid,
-                                            grid_stepsize);
-          }
-        }
-      }  //end za_prop loop
-    }    //end p_index loop
-  }      //end atmosphere_dim = 1
+    // The levels are independent, and the integration over the incoming
+    // directions of each is one matrix product
+    const Matrix weights =
+        doit_scat_field_weights(za_grid, aa_grid, grid_stepsize);
+    const Index Np = cloudbox_limits[1] - cloudbox_limits[0] + 1;
+
+    Matrix pha_mat_level;
+    Vector field_weighted;
+
+#pragma omp parallel for if (!arts_omp_in_parallel() && Np > 1) \
+    firstprivate(pha_mat_level, field_weighted)
+    for (Index p_index = 0; p_index < Np; p_index++) {
+      doit_scat_field1D(doit_scat_field(p_index, 0, 0, joker, 0, joker),
+                        pha_mat_level,
+                        field_weighted,
+                        pha_mat_doit,
+                        p_index,
+                        cloudbox_field_mono(p_index, 0, 0, joker, 0, joker),
+                        weights);
+    }
+  }  //end atmosphere_dim = 1
 
   //atmosphere_dim = 3
   else if (atmosphere_dim == 3) {
@@ -2207,86 +2218,110 @@ void doit_scat_fieldCalc(Workspace& ws,
         when we calculate the pha_mat from pha_mat_spt and pnd_field
         using the method pha_matCalc.  */
 
-    for (Index p_index = 0; p_index <= cloudbox_limits[1] - cloudbox_limits[0];
-         p_index++) {
-      for (Index lat_index = 0;
-           lat_index <= cloudbox_limits[3] - cloudbox_limits[2];
-           lat_index++) {
-        for (Index lon_index = 0;
-             lon_index <= cloudbox_limits[5] - cloudbox_limits[4];
-             lon_index++) {
-          Numeric rtp_temperature_local =
-              t_field(p_index + cloudbox_limits[0],
-                      lat_index + cloudbox_limits[2],
-                      lon_index + cloudbox_limits[4]);
-
-          for (Index aa_index_local = 1; aa_index_local < Naa;
-               aa_index_local++) {
-            for (Index za_index_local = 0; za_index_local < Nza;
-                 za_index_local++) {
-              out3 << "Calculate phase matrix \n";
-              pha_mat_spt_agendaExecute(ws,
-                                        pha_mat_spt_local,
-                                        za_index_local,
-                                        lat_index,
-                                        lon_index,
-                                        p_index,
-                                        aa_index_local,
-                                        rtp_temperature_local,
-                                        pha_mat_spt_agenda);
-
-              pha_matCalc(pha_mat_local,
-                          pha_mat_spt_local,
-                          pnd_field,
-                          atmosphere_dim,
-                          p_index,
-                          lat_index,
-                          lon_index,
-                          verbosity);
+    // The positions are independent, so they are calculated in parallel,
+    // each thread with its own workspace for pha_mat_spt_agenda
+    const Index Np = cloudbox_limits[1] - cloudbox_limits[0] + 1;
+    const Index Nlat = cloudbox_limits[3] - cloudbox_limits[2] + 1;
+    const Index Nlon = cloudbox_limits[5] - cloudbox_limits[4] + 1;
+
+    String fail_msg;
+    bool failed = false;
 
-              product_field = 0;
-
-              //za_in and aa_in are the incoming directions
-              //for which pha_mat_spt is calculated
-              for (Index za_in = 0; za_in < Nza; ++za_in) {
-                for (Index aa_in = 0; aa_in < Naa; ++aa_in) {
-                  // Multiplication of phase matrix
-                  // with incloming intensity field.
-                  for (Index i = 0; i < stokes_dim; i++) {
-                    for (Index j = 0; j < stokes_dim; j++) {
-                      product_field(za_in, aa_in, i) +=
-                          pha_mat_local(za_in, aa_in, i, j) *
-                          cloudbox_field_mono(p_index,
-                                              lat_index,
-                                              lon_index,
-                                              za_index_local,
-                                              aa_index_local,
-                                              j);
+    WorkspaceOmpParallelCopyGuard wss{ws};
+#pragma omp parallel for if (!arts_omp_in_parallel()) collapse(3) \
+    firstprivate(wss, pha_mat_local, pha_mat_spt_local, product_field)
+    for (Index p_index = 0; p_index < Np; p_index++) {
+      for (Index lat_index = 0; lat_index < Nlat; lat_index++) {
+        for (Index lon_index = 0; lon_index < Nlon; lon_index++) {
+          if (failed) continue;
+
+          try {
+            Numeric rtp_temperature_local =
+                t_field(p_index + cloudbox_limits[0],
+                        lat_index + cloudbox_limits[2],
+                        lon_index + cloudbox_limits[4]);
+
+            for (Index aa_index_local = 1; aa_index_local < Naa;
+                 aa_index_local++) {
+              for (Index za_index_local = 0; za_index_local < Nza;
+                   za_index_local++) {
+                out3 << "Calculate phase matrix \n";
+                pha_mat_spt_agendaExecute(wss,
+                                          pha_mat_spt_local,
+                                          za_index_local,
+                                          lat_index,
+                                          lon_index,
+                                          p_index,
+                                          aa_index_local,
+                                          rtp_temperature_local,
+                                          pha_mat_spt_agenda);
+
+                pha_matCalc(pha_mat_local,
+                            pha_mat_spt_local,
+                            pnd_field,
+                            atmosphere_dim,
+                            p_index,
+                            lat_index,
+                            lon_index,
+                            verbosity);
+
+                product_field = 0;
+
+                //za_in and aa_in are the incoming directions
+                //for which pha_mat_spt is calculated
+                for (Index za_in = 0; za_in < Nza; ++za_in) {
+                  for (Index aa_in = 0; aa_in < Naa; ++aa_in) {
+                    // Multiplication of phase matrix
+                    // with incloming intensity field.
+                    for (Index i = 0; i < stokes_dim; i++) {
+                      for (Index j = 0; j < stokes_dim; j++) {
+                        product_field(za_in, aa_in, i) +=
+                            pha_mat_local(za_in, aa_in, i, j) *
+                            cloudbox_field_mono(p_index,
+                                                lat_index,
+                                                lon_index,
+                                                za_index_local,
+                                                aa_index_local,
+                                                j);
+                      }
                     }
-                  }
-                }  //end aa_in loop
-              }    //end za_in loop
-              //integration of the product of ifield_in and pha
-              //over zenith angle and azimuth angle grid. It
-              //calls here the integration routine
-              //AngIntegrate_trapezoid_opti
-              for (Index i = 0; i < stokes_dim; i++) {
-                doit_scat_field(p_index,
-                                lat_index,
-                                lon_index,
-                                za_index_local,
-                                aa_index_local,
-                                i) =
-                    AngIntegrate_trapezoid_opti(product_field(joker, joker, i),
-                                                za_grid,
-                                                aa_grid,
-                                                grid_stepsize);
-              }  //end i loop
-            }    //end aa_prop loop
-          }      //end za_prop loop
-        }        //end lon loop
-      }          // end lat loop
-    }            // end p loop
+                  }  //end aa_in loop
+                }    //end za_in loop
+                //integration of the product of ifield_in and pha
+                //over zenith angle and azimuth angle grid. It
+                //calls here the integration routine
+                //AngIntegrate_trapezoid_opti
+                for (Index i = 0; i < stokes_dim; i++) {
+                  doit_scat_field(p_index,
+                                  lat_index,
+                                  lon_index,
+                                  za_index_local,
+                                  aa_index_local,
+                                  i) =
+                      AngIntegrate_trapezoid_opti(product_field(joker, joker, i),
+                                                  za_grid,
+                                                  aa_grid,
+                                                  grid_stepsize);
+                }  //end i loop
+              }    //end aa_prop loop
+            }      //end za_prop loop
+          } catch (const std::exception& e) {
+            ostringstream os;
+            os << "Error for position (" << p_index << ", " << lat_index
+               << ", " << lon_index << ") in the cloudbox:\n"
+               << e.what();
+#pragma omp critical(doit_scat_fieldCalc_fail)
+            {
+              failed = true;
+              fail_msg = os.str();
+            }
+          }
+        }  //end lon loop
+      }    // end lat loop
+    }      // end p loop
+
+    ARTS_USER_ERROR_IF(failed, fail_msg);
+
     // aa = 0 is the same as aa = 180:
     doit_scat_field(joker, joker, joker, joker, 0, joker) =
         doit_scat_field(joker, joker, joker, joker, Naa - 1, joker);
@@ -2449,10 +2484,18 @@ void doit_scat_fieldCalcLimb(Workspace& ws,
   Tensor3 product_field(doit_za_grid_size, Naa, stokes_dim, 0);
 
   if (atmosphere_dim == 1) {
-    // Get pha_mat at the grid positions
-    // Since atmosphere_dim = 1, there is no loop over lat and lon grids
-    for (Index p_index = 0; p_index <= cloudbox_limits[1] - cloudbox_limits[0];
-         p_index++) {
+    // The levels are independent, and the integration over the incoming
+    // directions of each is one matrix product
+    const Matrix weights = doit_scat_field_weights(za_g, aa_grid, grid_stepsize);
+    const Index Np = cloudbox_limits[1] - cloudbox_limits[0] + 1;
+
+    Matrix pha_mat_level;
+    Vector field_weighted;
+
+#pragma omp parallel for if (!arts_omp_in_parallel() && Np > 1) \
+    firstprivate(cloudbox_field_int, doit_scat_field_org, pha_mat_level, \
+                 field_weighted)
+    for (Index p_index = 0; p_index < Np; p_index++) {
       // Interpolate intensity field:
       for (Index i = 0; i < stokes_dim; i++) {
         if (doit_za_interp == 0) {
@@ -2475,51 +2518,14 @@ void doit_scat_fieldCalcLimb(Workspace& ws,
           ARTS_ASSERT(false);
       }
 
-      //There is only loop over zenith angle grid; no azimuth angle grid.
-      for (Index za_index_local = 0; za_index_local < doit_za_grid_size;
-           za_index_local++) {
-        out3 << "Multiplication of phase matrix with incoming"
-             << " intensities \n";
-
-        product_field = 0;
-
-        // za_in and aa_in are for incoming zenith and azimuth
-        // angle direction for which pha_mat is calculated
-        for (Index za_in = 0; za_in < doit_za_grid_size; za_in++) {
-          for (Index aa_in = 0; aa_in < Naa; ++aa_in) {
-            // Multiplication of phase matrix with incoming
-            // intensity field.
-
-            for (Index i = 0; i < stokes_dim; i++) {
-              for (Index j = 0; j < stokes_dim; j++) {
-                product_field(za_in, aa_in, i) +=
-                    pha_mat_doit(
-                        p_index, za_index_local, 0, za_in, aa_in, i, j) *
-                    cloudbox_field_int(za_in, j);
-              }
-            }
-
-          }  //end aa_in loop
-        }    //end za_in loop
-
-        out3 << "Compute integral. \n";
-        if (Naa == 1) {
-          for (Index i = 0; i < stokes_dim; i++) {
-            doit_scat_field_org(za_index_local, i) =
-                AngIntegrate_trapezoid(product_field(joker, 0, i), za_g) / 2 /
-                PI;
-          }  //end i loop
-        } else {
-          for (Index i = 0; i < stokes_dim; i++) {
-            doit_scat_field_org(za_index_local, i) =
-                AngIntegrate_trapezoid_opti(product_field(joker, joker, i),
-                                            za_g,
-                                            aa_grid,
-                                            grid_stepsize);
-          }
-        }
-
-      }  //end za_prop loop
+      // Integration over the incoming directions
+      doit_scat_field1D(doit_scat_field_org,
+                        pha_mat_level,
+                        field_weighted,
+                        pha_mat_doit,
+                        p_index,
+                        cloudbox_field_int,
+                        weights);
 
       // Interpolation on za_grid, which is used in
       // radiative transfer part.
@@ -2543,100 +2549,122 @@ void doit_scat_fieldCalcLimb(Workspace& ws,
   }  //end atmosphere_dim = 1
 
   else if (atmosphere_dim == 3) {
-    // Loop over all positions
-    for (Index p_index = 0; p_index <= cloudbox_limits[1] - cloudbox_limits[0];
-         p_index++) {
-      for (Index lat_index = 0;
-           lat_index <= cloudbox_limits[3] - cloudbox_limits[2];
-           lat_index++) {
-        for (Index lon_index = 0;
-             lon_index <= cloudbox_limits[5] - cloudbox_limits[4];
-             lon_index++) {
-          Numeric rtp_temperature_local =
-              t_field(p_index + cloudbox_limits[0],
-                      lat_index + cloudbox_limits[2],
-                      lon_index + cloudbox_limits[4]);
-
-          // Loop over scattered directions
-          for (Index aa_index_local = 1; aa_index_local < Naa;
-               aa_index_local++) {
-            // Interpolate intensity field:
-            for (Index i = 0; i < stokes_dim; i++) {
-              interp(
-                  cloudbox_field_int(joker, i),
-                  itw_za_i,
-                  cloudbox_field_mono(
-                      p_index, lat_index, lon_index, joker, aa_index_local, i),
-                  gp_za_i);
-            }
+    // Loop over all positions, in parallel with a workspace per thread
+    const Index Np = cloudbox_limits[1] - cloudbox_limits[0] + 1;
+    const Index Nlat = cloudbox_limits[3] - cloudbox_limits[2] + 1;
+    const Index Nlon = cloudbox_limits[5] - cloudbox_limits[4] + 1;
 
-            for (Index za_index_local = 0; za_index_local < doit_za_grid_size;
-                 za_index_local++) {
-              out3 << "Calculate phase matrix \n";
-              pha_mat_spt_agendaExecute(ws,
-                                        pha_mat_spt_local,
-                                        za_index_local,
-                                        lat_index,
-                                        lon_index,
-                                        p_index,
-                                        aa_index_local,
-                                        rtp_temperature_local,
-                                        pha_mat_spt_agenda);
-
-              pha_matCalc(pha_mat_local,
-                          pha_mat_spt_local,
-                          pnd_field,
-                          atmosphere_dim,
-                          p_index,
-                          lat_index,
-                          lon_index,
-                          verbosity);
+    String fail_msg;
+    bool failed = false;
+
+    WorkspaceOmpParallelCopyGuard wss{ws};
+#pragma omp parallel for if (!arts_omp_in_parallel()) collapse(3) \
+    firstprivate(wss, pha_mat_local, pha_mat_spt_local, product_field, cloudbox_field_int, doit_scat_field_org)
+    for (Index p_index = 0; p_index < Np; p_index++) {
+      for (Index lat_index = 0; lat_index < Nlat; lat_index++) {
+        for (Index lon_index = 0; lon_index < Nlon; lon_index++) {
+          if (failed) continue;
+
+          try {
+            Numeric rtp_temperature_local =
+                t_field(p_index + cloudbox_limits[0],
+                        lat_index + cloudbox_limits[2],
+                        lon_index + cloudbox_limits[4]);
+
+            // Loop over scattered directions
+            for (Index aa_index_local = 1; aa_index_local < Naa;
+                 aa_index_local++) {
+              // Interpolate intensity field:
+              for (Index i = 0; i < stokes_dim; i++) {
+                interp(
+                    cloudbox_field_int(joker, i),
+                    itw_za_i,
+                    cloudbox_field_mono(
+                        p_index, lat_index, lon_index, joker, aa_index_local, i),
+                    gp_za_i);
+              }
 
-              product_field = 0;
-
-              //za_in and aa_in are the incoming directions
-              //for which pha_mat_spt is calculated
-              out3 << "Multiplication of phase matrix with"
-                   << "incoming intensity \n";
-
-              for (Index za_in = 0; za_in < doit_za_grid_size; za_in++) {
-                for (Index aa_in = 0; aa_in < Naa; ++aa_in) {
-                  // Multiplication of phase matrix
-                  // with incloming intensity field.
-                  for (Index i = 0; i < stokes_dim; i++) {
-                    for (Index j = 0; j < stokes_dim; j++) {
-                      product_field(za_in, aa_in, i) +=
-                          pha_mat_local(za_in, aa_in, i, j) *
-                          cloudbox_field_int(za_in, j);
+              for (Index za_index_local = 0; za_index_local < doit_za_grid_size;
+                   za_index_local++) {
+                out3 << "Calculate phase matrix \n";
+                pha_mat_spt_agendaExecute(wss,
+                                          pha_mat_spt_local,
+                                          za_index_local,
+                                          lat_index,
+                                          lon_index,
+                                          p_index,
+                                          aa_index_local,
+                                          rtp_temperature_local,
+                                          pha_mat_spt_agenda);
+
+                pha_matCalc(pha_mat_local,
+                            pha_mat_spt_local,
+                            pnd_field,
+                            atmosphere_dim,
+                            p_index,
+                            lat_index,
+                            lon_index,
+                            verbosity);
+
+                product_field = 0;
+
+                //za_in and aa_in are the incoming directions
+                //for which pha_mat_spt is calculated
+                out3 << "Multiplication of phase matrix with"
+                     << "incoming intensity \n";
+
+                for (Index za_in = 0; za_in < doit_za_grid_size; za_in++) {
+                  for (Index aa_in = 0; aa_in < Naa; ++aa_in) {
+                    // Multiplication of phase matrix
+                    // with incloming intensity field.
+                    for (Index i = 0; i < stokes_dim; i++) {
+                      for (Index j = 0; j < stokes_dim; j++) {
+                        product_field(za_in, aa_in, i) +=
+                            pha_mat_local(za_in, aa_in, i, j) *
+                            cloudbox_field_int(za_in, j);
+                      }
                     }
-                  }
-                }  //end aa_in loop
-              }    //end za_in loop
+                  }  //end aa_in loop
+                }    //end za_in loop
+
+                out3 << "Compute the integral \n";
 
-              out3 << "Compute the integral \n";
+                for (Index i = 0; i < stokes_dim; i++) {
+                  doit_scat_field_org(za_index_local, i) =
+                      AngIntegrate_trapezoid_opti(product_field(joker, joker, i),
+                                                  za_grid,
+                                                  aa_grid,
+                                                  grid_stepsize);
+                }  //end stokes_dim loop
 
+              }  //end za_prop loop
+              //Interpolate on original za_grid.
               for (Index i = 0; i < stokes_dim; i++) {
-                doit_scat_field_org(za_index_local, i) =
-                    AngIntegrate_trapezoid_opti(product_field(joker, joker, i),
-                                                za_grid,
-                                                aa_grid,
-                                                grid_stepsize);
-              }  //end stokes_dim loop
-
-            }  //end za_prop loop
-            //Interpolate on original za_grid.
-            for (Index i = 0; i < stokes_dim; i++) {
-              interp(
-                  doit_scat_field(
-                      p_index, lat_index, lon_index, joker, aa_index_local, i),
-                  itw_za,
-                  doit_scat_field_org(joker, i),
-                  gp_za);
+                interp(
+                    doit_scat_field(
+                        p_index, lat_index, lon_index, joker, aa_index_local, i),
+                    itw_za,
+                    doit_scat_field_org(joker, i),
+                    gp_za);
+              }
+            }  // end aa_prop loop
+          } catch (const std::exception& e) {
+            ostringstream os;
+            os << "Error for position (" << p_index << ", " << lat_index
+               << ", " << lon_index << ") in the cloudbox:\n"
+               << e.what();
+#pragma omp critical(doit_scat_fieldCalcLimb_fail)
+            {
+              failed = true;
+              fail_msg = os.str();
             }
-          }  // end aa_prop loop
+          }
         }    //end lon loop
       }      //end lat loop
     }        // end p loop
+
+    ARTS_USER_ERROR_IF(failed, fail_msg);
+
     doit_scat_field(joker, joker, joker, joker, 0, joker) =
         doit_scat_field(joker, joker, joker, joker, Naa - 1, joker);
   }  // end atm_dim=3
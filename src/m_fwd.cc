@@ -1,6 +1,7 @@
 #include <fwd.h>
 
 #include <algorithm>
+#include <memory>
 
 #include "agenda_set.h"
 #include "auto_md.h"
@@ -82,15 +83,16 @@ void spectral_radiance_profile_operatorPlaneParallel(
   std::vector<Vector> allvmrs{ppvar_vmr.begin(), ppvar_vmr.end()};
   std::reverse(allvmrs.begin(), allvmrs.end());
 
+  const auto catalog = std::make_shared<const fwd::catalog>(
+      predefined_model_data, abs_cia_data, xsec_fit_data);
+
   spectral_radiance_profile_operator =
       SpectralRadianceProfileOperator(z,
                                       p,
                                       t,
                                       allvmrs,
                                       abs_species,
-                                      predefined_model_data,
-                                      abs_cia_data,
-                                      xsec_fit_data,
+                                      catalog,
                                       isotopologue_ratios,
                                       abs_lines_per_species,
                                       cia_extrap,
@@ -11,11 +11,14 @@
   === External declarations
   ===========================================================================*/
 
+#include <array>
 #include <cmath>
 #include <ctime>
 #include <fstream>
 #include <stdexcept>
+#include <vector>
 #include "arts.h"
+#include "arts_omp.h"
 #include "arts_constants.h"
 #include "arts_conversions.h"
 #include "auto_md.h"
@@ -184,12 +187,8 @@ void MCGeneral(Workspace& ws,
     throw runtime_error(os.str());
   }
 
-  Ppath ppath_step;
-  RandomNumberGenerator<> rng;  //Random Number generator
   time_t start_time = time(NULL);
   Index N_se = pnd_field.nbooks();  //Number of scattering elements
-  Vector pnd_vec(
-      N_se);  //Vector of particle number densities used at each point
   Vector Z11maxvector(
       N_se);  //Vector holding the maximum phase function for each
 
@@ -204,20 +203,8 @@ void MCGeneral(Workspace& ws,
     }
   }
 
-  rng.seed(mc_seed);
-
-  Numeric g, temperature, albedo, g_los_csc_theta;
-  Matrix A(stokes_dim, stokes_dim), Q(stokes_dim, stokes_dim);
-  Matrix evol_op(stokes_dim, stokes_dim), ext_mat_mono(stokes_dim, stokes_dim);
-  Matrix q(stokes_dim, stokes_dim), newQ(stokes_dim, stokes_dim);
-  Matrix Z(stokes_dim, stokes_dim);
-  Matrix R_ant2enu(3, 3),
-      R_stokes(stokes_dim, stokes_dim);  // Needed for antenna rotations
-  q = 0.0;
-  newQ = 0.0;
-  Vector vector1(stokes_dim), abs_vec_mono(stokes_dim), I_i(stokes_dim);
+  Matrix R_ant2enu(3, 3);  // Needed for antenna rotations
   Vector Isum(stokes_dim), Isquaredsum(stokes_dim);
-  Index termination_flag = 0;
   const Numeric f_mono = f_grid[f_index];
   const Numeric prop_dir =
       -1.0;  // propagation direction opposite of los angles
@@ -236,15 +223,6 @@ void MCGeneral(Workspace& ws,
   mc_source_domain.resize(4);
   mc_source_domain = 0;
 
-  //local versions of workspace
-  Numeric local_surface_skin_t;
-  Matrix local_iy(1, stokes_dim), local_surface_emission(1, stokes_dim);
-  Matrix local_surface_los;
-  Tensor4 local_surface_rmatrix;
-  Vector local_rte_pos(3);  // Fixed this (changed from 2 to 3)
-  Vector local_rte_los(2);
-  Vector new_rte_los(2);
-  Index np;
   Isum = 0.0;
   Isquaredsum = 0.0;
   Numeric std_err_i;
@@ -265,22 +243,52 @@ void MCGeneral(Workspace& ws,
   // Calculate rotation matrix for boresight
   rotmat_enu(R_ant2enu, sensor_los(0, joker));
 
-  //Begin Main Loop
-  //
-  bool keepgoing, oksampling;
-  Index nfails = 0;
-  //
-  while (true) {
-    // Complete content of while inside try/catch to handle occasional
-    // failures in the ppath calculations
-    try {
-      bool inside_cloud;
+  // The outcome of tracing a single photon
+  struct Photon {
+    Vector I;
+    bool oksampling{true};
+    Index source_domain{-1};
+    Index scattering_order{0};
+    std::array<Index, 3> end_point{};
+    String error{};
+  };
+
+  // Traces photon number iphoton, using its own random number stream so
+  // that the outcome does not depend on the thread that traces it
+  const auto trace_photon = [&](Workspace& ws_local, Index iphoton) {
+    Photon photon;
+    photon.I.resize(stokes_dim);
+    photon.I = 0.0;
 
-      mc_iteration_count += 1;
-      Index scattering_order = 0;
+    try {
+      RandomNumberStream<> rng(mc_seed, iphoton);
+
+      Ppath ppath_step;
+      Numeric g, temperature, albedo, g_los_csc_theta;
+      Matrix Q(stokes_dim, stokes_dim);
+      Matrix evol_op(stokes_dim, stokes_dim),
+          ext_mat_mono(stokes_dim, stokes_dim);
+      Matrix q(stokes_dim, stokes_dim), newQ(stokes_dim, stokes_dim);
+      Matrix Z(stokes_dim, stokes_dim);
+      Matrix R_stokes(stokes_dim, stokes_dim);
+      q = 0.0;
+      newQ = 0.0;
+      Vector vector1(stokes_dim), abs_vec_mono(stokes_dim);
+      Vector pnd_vec(N_se);
+      Index termination_flag = 0;
+
+      //local versions of workspace
+      Numeric local_surface_skin_t;
+      Matrix local_iy(1, stokes_dim), local_surface_emission(1, stokes_dim);
+      Matrix local_surface_los;
+      Tensor4 local_surface_rmatrix;
+      Vector local_rte_pos(3);  // Fixed this (changed from 2 to 3)
+      Vector local_rte_los(2);
+      Vector new_rte_los(2);
 
-      keepgoing = true;   // indicating whether to continue tracing a photon
-      oksampling = true;  // gets false if g becomes zero
+      bool inside_cloud;
+      bool keepgoing = true;  // indicating whether to continue tracing a photon
+      Vector& I_i = photon.I;
 
       //Sample a FOV direction
       Matrix R_prop(3, 3);
@@ -292,10 +300,9 @@ void MCGeneral(Workspace& ws,
           R_stokes, stokes_dim, prop_dir, prop_dir, R_prop, R_ant2enu);
       id_mat(Q);
       local_rte_pos = sensor_pos(0, joker);
-      I_i = 0.0;
 
       while (keepgoing) {
-        mcPathTraceGeneral(ws,
+        mcPathTraceGeneral(ws_local,
                            evol_op,
                            abs_vec_mono,
                            temperature,
@@ -339,12 +346,9 @@ void MCGeneral(Workspace& ws,
         // scenarios, as this goes wrong regardless of the scenario.
         if (g == 0) {
           keepgoing = false;
-          oksampling = false;
-          mc_iteration_count -= 1;
-          out0 << "WARNING: A rejected path sampling (g=0)!\n(if this"
-               << "happens repeatedly, try to decrease *ppath_lmax*)";
+          photon.oksampling = false;
         } else if (termination_flag == 1) {
-          iy_space_agendaExecute(ws,
+          iy_space_agendaExecute(ws_local,
                                  local_iy,
                                  Vector(1, f_mono),
                                  local_rte_pos,
@@ -354,10 +358,10 @@ void MCGeneral(Workspace& ws,
           mult(I_i, Q, vector1);
           I_i /= g;
           keepgoing = false;  //stop here. New photon.
-          mc_source_domain[0] += 1;
+          photon.source_domain = 0;
         } else if (termination_flag == 2) {
           //Calculate surface properties
-          surface_rtprop_agendaExecute(ws,
+          surface_rtprop_agendaExecute(ws_local,
                                        local_surface_skin_t,
                                        local_surface_emission,
                                        local_surface_los,
@@ -377,7 +381,7 @@ void MCGeneral(Workspace& ws,
             mult(I_i, Q, vector1);
             I_i /= g;
             keepgoing = false;
-            mc_source_domain[1] += 1;
+            photon.source_domain = 1;
           } else
           //decide between reflection and emission
           {
@@ -394,7 +398,7 @@ void MCGeneral(Workspace& ws,
               mult(I_i, Q, vector1);
               I_i /= g * (1 - R11);
               keepgoing = false;
-              mc_source_domain[1] += 1;
+              photon.source_domain = 1;
             } else {
               //we have reflection
               // determine which reflection los to use
@@ -429,7 +433,7 @@ void MCGeneral(Workspace& ws,
             emissioncontri /= (g * (1 - albedo));  //yuck!
             mult(I_i, Q, emissioncontri);
             keepgoing = false;
-            mc_source_domain[3] += 1;
+            photon.source_domain = 3;
           } else {
             //we have a scattering event
             Sample_los(new_rte_los,
@@ -451,7 +455,7 @@ void MCGeneral(Workspace& ws,
             mult(q, evol_op, Z);
             mult(newQ, Q, q);
             Q = newQ;
-            scattering_order += 1;
+            photon.scattering_order += 1;
             local_rte_los = new_rte_los;
           }
         } else {
@@ -465,63 +469,122 @@ void MCGeneral(Workspace& ws,
           emissioncontri /= g;
           mult(I_i, Q, emissioncontri);
           keepgoing = false;
-          mc_source_domain[2] += 1;
+          photon.source_domain = 2;
         }
       }  // keepgoing
 
-      if (oksampling) {
-        // Set spome of the bookkeeping variables
-        np = ppath_step.np;
-        mc_points(ppath_step.gp_p[np - 1].idx,
-                  ppath_step.gp_lat[np - 1].idx,
-                  ppath_step.gp_lon[np - 1].idx) += 1;
-        if (scattering_order < l_mc_scat_order) {
-          mc_scat_order[scattering_order] += 1;
-        }
+      if (photon.oksampling) {
+        const Index np = ppath_step.np;
+        photon.end_point = {ppath_step.gp_p[np - 1].idx,
+                            ppath_step.gp_lat[np - 1].idx,
+                            ppath_step.gp_lon[np - 1].idx};
+      }
+    } catch (const std::runtime_error& e) {
+      photon.error = e.what();
+    }
 
-        // Rotate into antenna polarization frame
-        Vector I_hold(stokes_dim);
-        mult(I_hold, R_stokes, I_i);
-        Isum += I_i;
+    return photon;
+  };
 
-        for (Index j = 0; j < stokes_dim; j++) {
-          ARTS_ASSERT(!std::isnan(I_i[j]));
-          Isquaredsum[j] += I_i[j] * I_i[j];
-        }
-        y = Isum;
-        y /= (Numeric)mc_iteration_count;
-        for (Index j = 0; j < stokes_dim; j++) {
-          mc_error[j] = sqrt(
-              (Isquaredsum[j] / (Numeric)mc_iteration_count - y[j] * y[j]) /
-              (Numeric)mc_iteration_count);
-        }
-        if (std_err > 0 && mc_iteration_count >= min_iter &&
-            mc_error[0] < std_err_i) {
-          break;
-        }
-        if (max_time > 0 && (Index)(time(NULL) - start_time) >= max_time) {
-          break;
-        }
-        if (max_iter > 0 && mc_iteration_count >= max_iter) {
-          break;
+  //Begin Main Loop
+  //
+  // Photons are traced in parallel in batches.  The photons of a batch are
+  // then added to the sums one at a time in the order of their index, with
+  // the stopping criteria checked after each photon.  The result for a given
+  // mc_seed is therefore the same as for a serial run, independent of the
+  // number of threads, except when stopping on mc_max_time.
+  const bool do_parallel =
+      not arts_omp_in_parallel() and arts_omp_get_max_threads() > 1;
+  const Index nbatch = do_parallel ? 4 * arts_omp_get_max_threads() : 1;
+  std::vector<Photon> photons(nbatch);
+  Index nfails = 0;
+  Index nphotons = 0;
+  bool keepgoing = true;
+  //
+  String fail_msg;
+  bool failed = false;
+  WorkspaceOmpParallelCopyGuard wss{ws, do_parallel};
+  while (keepgoing) {
+#pragma omp parallel for if (do_parallel) firstprivate(wss)
+    for (Index i = 0; i < nbatch; i++) {
+      if (failed) continue;
+      try {
+        photons[i] = trace_photon(wss, nphotons + i);
+      } catch (const std::exception& e) {
+#pragma omp critical(MCGeneral_fail)
+        {
+          failed = true;
+          fail_msg = e.what();
         }
       }
-    }  // Try
+    }
+    ARTS_USER_ERROR_IF(failed, fail_msg);
+    nphotons += nbatch;
 
-    catch (const std::runtime_error& e) {
+    for (auto& photon : photons) {
       mc_iteration_count += 1;
-      nfails += 1;
-      out0 << "WARNING: A MC path sampling failed! Error was:\n";
-      cout << e.what() << endl;
-      if (nfails >= 5) {
-        throw runtime_error(
-            "The MC path sampling has failed five times. A few failures "
-            "should be OK, but this number is suspiciously high and the "
-            "reason to these failures should be tracked down.");
+
+      if (photon.error.size()) {
+        mc_iteration_count += 1;
+        nfails += 1;
+        out0 << "WARNING: A MC path sampling failed! Error was:\n";
+        cout << photon.error << endl;
+        if (nfails >= 5) {
+          throw runtime_error(
+              "The MC path sampling has failed five times. A few failures "
+              "should be OK, but this number is suspiciously high and the "
+              "reason to these failures should be tracked down.");
+        }
+        continue;
+      }
+
+      if (not photon.oksampling) {
+        mc_iteration_count -= 1;
+        out0 << "WARNING: A rejected path sampling (g=0)!\n(if this"
+             << "happens repeatedly, try to decrease *ppath_lmax*)";
+        continue;
+      }
+
+      // Set spome of the bookkeeping variables
+      mc_source_domain[photon.source_domain] += 1;
+      mc_points(photon.end_point[0],
+                photon.end_point[1],
+                photon.end_point[2]) += 1;
+      if (photon.scattering_order < l_mc_scat_order) {
+        mc_scat_order[photon.scattering_order] += 1;
+      }
+
+      const Vector& I_i = photon.I;
+      Isum += I_i;
+
+      for (Index j = 0; j < stokes_dim; j++) {
+        ARTS_ASSERT(!std::isnan(I_i[j]));
+        Isquaredsum[j] += I_i[j] * I_i[j];
+      }
+      y = Isum;
+      y /= (Numeric)mc_iteration_count;
+      for (Index j = 0; j < stokes_dim; j++) {
+        mc_error[j] = sqrt(
+            (Isquaredsum[j] / (Numeric)mc_iteration_count - y[j] * y[j]) /
+            (Numeric)mc_iteration_count);
+      }
+      if (std_err > 0 && mc_iteration_count >= min_iter &&
+          mc_error[0] < std_err_i) {
+        keepgoing = false;
+        break;
+      }
+      if (max_time > 0 && (Index)(time(NULL) - start_time) >= max_time) {
+        keepgoing = false;
+        break;
+      }
+      if (max_iter > 0 && mc_iteration_count >= max_iter) {
+        keepgoing = false;
+        break;
       }
     }
   }  // while
 
+
   if (convert_to_rjbt) {
     for (Index j = 0; j < stokes_dim; j++) {
       y[j] = invrayjean(y[j], f_mono);
@@ -658,7 +721,6 @@ void MCRadar(  // Workspace reference:
   }
 
   Ppath ppath_step;
-  RandomNumberGenerator<> rng(mc_seed);                          //Random Number generator
   Index N_se = pnd_field.nbooks();  //Number of scattering elements
   Vector pnd_vec(
       N_se);  //Vector of particle number densities used at each point
@@ -763,6 +825,9 @@ void MCRadar(  // Workspace reference:
 
     mc_iter += 1;
 
+    // Each photon has its own reproducible random number stream
+    RandomNumberStream<> rng(mc_seed, mc_iter);
+
     integrity = true;  // intensity is not nan or below threshold
     keepgoing = true;  // indicating whether to continue tracing a photon
     firstpass = true;  // ensure backscatter is properly calculated
@@ -1365,8 +1365,13 @@ void iyEmissionHybrid(Workspace& ws,
                               iy_unit);
 }
 
-/* Workspace method: Doxygen documentation will be auto-generated */
-void iyEmissionStandard(
+//! The common part of iyEmissionStandard and iyEmissionStandardPpvarPropmatAgenda
+/*!
+  The propagation matrices are calculated by executing propmat_agenda either
+  as *propmat_clearsky_agenda*, once per ppath point, or, if ppvar_agenda is
+  true, as *ppvar_propmat_agenda*, once for the whole ppath.
+*/
+void iy_emission_standard_internal(
     Workspace& ws,
     Matrix& iy,
     ArrayOfMatrix& iy_aux,
@@ -1403,7 +1408,8 @@ void iyEmissionStandard(
     const ArrayOfRetrievalQuantity& jacobian_quantities,
     const Ppath& ppath,
     const Vector& rte_pos2,
-    const Agenda& propmat_clearsky_agenda,
+    const Agenda& propmat_agenda,
+    const bool ppvar_agenda,
     const Agenda& water_p_eq_agenda,
     const String& rt_integration_option,
     const Agenda& iy_main_agenda,
@@ -1427,6 +1433,14 @@ void iyEmissionStandard(
   // Radiative background index
   const Index rbi = ppath_what_background(ppath);
 
+  // Unpolarized first order calculations without analytical Jacobians are
+  // done on flat per-level vectors instead of on transmission matrices
+  const bool scalar_rt =
+      ns == 1 and not j_analytical_do and
+      (rt_integration_option == "first order" or
+       rt_integration_option == "default");
+  const Index npm = scalar_rt ? 0 : np;
+
   // Checks of input
   ARTS_USER_ERROR_IF (rbi < 1 || rbi > 9,
         "ppath.background is invalid. Check your "
@@ -1473,19 +1487,23 @@ void iyEmissionStandard(
   ppvar_trans_partial.resize(np, nf, ns, ns);
   ppvar_iy.resize(nf, ns, np);
 
-  ArrayOfRadiationVector lvl_rad(np, RadiationVector(nf, ns));
+  ArrayOfRadiationVector lvl_rad(npm, RadiationVector(nf, ns));
   ArrayOfArrayOfRadiationVector dlvl_rad(
-      np, ArrayOfRadiationVector(nq, RadiationVector(nf, ns)));
+      npm, ArrayOfRadiationVector(nq, RadiationVector(nf, ns)));
 
-  ArrayOfRadiationVector src_rad(np, RadiationVector(nf, ns));
+  ArrayOfRadiationVector src_rad(npm, RadiationVector(nf, ns));
   ArrayOfArrayOfRadiationVector dsrc_rad(
-      np, ArrayOfRadiationVector(nq, RadiationVector(nf, ns)));
+      npm, ArrayOfRadiationVector(nq, RadiationVector(nf, ns)));
 
-  ArrayOfTransmissionMatrix lyr_tra(np, TransmissionMatrix(nf, ns));
+  ArrayOfTransmissionMatrix lyr_tra(npm, TransmissionMatrix(nf, ns));
   ArrayOfArrayOfTransmissionMatrix dlyr_tra_above(
-      np, ArrayOfTransmissionMatrix(nq, TransmissionMatrix(nf, ns)));
+      npm, ArrayOfTransmissionMatrix(nq, TransmissionMatrix(nf, ns)));
   ArrayOfArrayOfTransmissionMatrix dlyr_tra_below(
-      np, ArrayOfTransmissionMatrix(nq, TransmissionMatrix(nf, ns)));
+      npm, ArrayOfTransmissionMatrix(nq, TransmissionMatrix(nf, ns)));
+
+  // Scalar versions of the above, one row per level
+  const Index nps = scalar_rt ? np : 0;
+  Matrix lvl_rad_scl(nps, nf), src_rad_scl(nps, nf), lyr_tra_scl(nps, nf, 1.0);
 
   ArrayOfPropagationMatrix K(np, PropagationMatrix(nf, ns));
   ArrayOfArrayOfPropagationMatrix dK_dx(np);
@@ -1566,6 +1584,35 @@ void iyEmissionStandard(
     ArrayOfString fail_msg;
     bool do_abort = false;
 
+    // Propagation matrices of all points in one go
+    ArrayOfStokesVector ppvar_nlte_source;
+    ArrayOfArrayOfStokesVector ppvar_dnlte_source;
+    if (ppvar_agenda) {
+      ArrayOfArrayOfPropagationMatrix ppvar_dpropmat;
+      ppvar_propmat_agendaExecute(
+          ws,
+          K,
+          ppvar_nlte_source,
+          ppvar_dpropmat,
+          ppvar_dnlte_source,
+          j_analytical_do ? jacobian_quantities : ArrayOfRetrievalQuantity(0),
+          ppvar_f,
+          ppvar_mag,
+          ppath,
+          ppvar_p,
+          ppvar_t,
+          ppvar_nlte,
+          ppvar_vmr,
+          propmat_agenda);
+
+      ARTS_USER_ERROR_IF(
+          K.nelem() not_eq np or ppvar_nlte_source.nelem() not_eq np or
+              (j_analytical_do and (ppvar_dpropmat.nelem() not_eq np or
+                                    ppvar_dnlte_source.nelem() not_eq np)),
+          "*ppvar_propmat_agenda* must return one element per ppath point")
+      if (j_analytical_do) dK_dx = std::move(ppvar_dpropmat);
+    }
+
     WorkspaceOmpParallelCopyGuard wss{ws};
 
     // Loop ppath points and determine radiative properties
@@ -1578,22 +1625,28 @@ void iyEmissionStandard(
             B, dB_dT, ppvar_f(joker, ip), ppvar_t[ip], temperature_jacobian);
 
         Index lte;
-        get_stepwise_clearsky_propmat(wss,
-                                      K[ip],
-                                      S,
-                                      lte,
-                                      dK_dx[ip],
-                                      dS_dx,
-                                      propmat_clearsky_agenda,
-                                      jacobian_quantities,
-                                      Vector{ppvar_f(joker, ip)},
-                                      Vector{ppvar_mag(joker, ip)},
-                                      Vector{ppath.los(ip, joker)},
-                                      ppvar_nlte[ip],
-                                      Vector{ppvar_vmr(joker, ip)},
-                                      ppvar_t[ip],
-                                      ppvar_p[ip],
-                                      j_analytical_do);
+        if (ppvar_agenda) {
+          S = ppvar_nlte_source[ip];
+          if (j_analytical_do) dS_dx = ppvar_dnlte_source[ip];
+          lte = S.allZeroes();
+        } else {
+          get_stepwise_clearsky_propmat(wss,
+                                        K[ip],
+                                        S,
+                                        lte,
+                                        dK_dx[ip],
+                                        dS_dx,
+                                        propmat_agenda,
+                                        jacobian_quantities,
+                                        Vector{ppvar_f(joker, ip)},
+                                        Vector{ppvar_mag(joker, ip)},
+                                        Vector{ppath.los(ip, joker)},
+                                        ppvar_nlte[ip],
+                                        Vector{ppvar_vmr(joker, ip)},
+                                        ppvar_t[ip],
+                                        ppvar_p[ip],
+                                        j_analytical_do);
+        }
 
         if (j_analytical_do)
           adapt_stepwise_partial_derivatives(dK_dx[ip],
@@ -1610,19 +1663,22 @@ void iyEmissionStandard(
         if (j_analytical_do)
           FOR_ANALYTICAL_JACOBIANS_DO(da_dx[iq] = dK_dx[ip][iq];);
 
-        stepwise_source(src_rad[ip],
-                        dsrc_rad[ip],
-                        J_add_dummy,
-                        K[ip],
-                        a,
-                        S,
-                        dK_dx[ip],
-                        da_dx,
-                        dS_dx,
-                        B,
-                        dB_dT,
-                        jacobian_quantities,
-                        jacobian_do);
+        if (scalar_rt)
+          stepwise_scalar_source(src_rad_scl(ip, joker), K[ip], a, S, B);
+        else
+          stepwise_source(src_rad[ip],
+                          dsrc_rad[ip],
+                          J_add_dummy,
+                          K[ip],
+                          a,
+                          S,
+                          dK_dx[ip],
+                          da_dx,
+                          dS_dx,
+                          B,
+                          dB_dT,
+                          jacobian_quantities,
+                          jacobian_do);
       } catch (const std::runtime_error& e) {
         ostringstream os;
         os << "Runtime-error in source calculation at index " << ip
@@ -1644,17 +1700,21 @@ void iyEmissionStandard(
             do_hse ? ppath.lstep[ip - 1] / (2.0 * ppvar_t[ip - 1]) : 0;
         const Numeric dr_dT_this =
             do_hse ? ppath.lstep[ip - 1] / (2.0 * ppvar_t[ip]) : 0;
-        stepwise_transmission(lyr_tra[ip],
-                              dlyr_tra_above[ip],
-                              dlyr_tra_below[ip],
-                              K[ip - 1],
-                              K[ip],
-                              dK_dx[ip - 1],
-                              dK_dx[ip],
-                              ppath.lstep[ip - 1],
-                              dr_dT_past,
-                              dr_dT_this,
-                              temperature_derivative_position);
+        if (scalar_rt)
+          stepwise_scalar_transmission(
+              lyr_tra_scl(ip, joker), K[ip - 1], K[ip], ppath.lstep[ip - 1]);
+        else
+          stepwise_transmission(lyr_tra[ip],
+                                dlyr_tra_above[ip],
+                                dlyr_tra_below[ip],
+                                K[ip - 1],
+                                K[ip],
+                                dK_dx[ip - 1],
+                                dK_dx[ip],
+                                ppath.lstep[ip - 1],
+                                dr_dT_past,
+                                dr_dT_this,
+                                temperature_derivative_position);
 
         r[ip - 1] = ppath.lstep[ip - 1];
         if (temperature_derivative_position >= 0){
@@ -1678,20 +1738,31 @@ void iyEmissionStandard(
       "Error messages from failed cases:\n", fail_msg)
   }
 
-  const ArrayOfTransmissionMatrix tot_tra =
-      cumulative_transmission(lyr_tra, CumulativeTransmission::Forward);
+  ArrayOfTransmissionMatrix tot_tra;
+  Matrix tot_tra_scl(nps, nf, 1.0);
+  Tensor3 tot_tra_space;
+  if (scalar_rt) {
+    for (Index ip = 1; ip < np; ip++)
+      for (Index iv = 0; iv < nf; iv++)
+        tot_tra_scl(ip, iv) = tot_tra_scl(ip - 1, iv) * lyr_tra_scl(ip, iv);
+    tot_tra_space.resize(nf, 1, 1);
+    tot_tra_space(joker, 0, 0) = tot_tra_scl(np - 1, joker);
+  } else {
+    tot_tra = cumulative_transmission(lyr_tra, CumulativeTransmission::Forward);
+    tot_tra_space = tot_tra[np - 1];
+  }
 
   // iy_transmittance
   Tensor3 iy_trans_new;
   if (iy_agenda_call1)
-    iy_trans_new = tot_tra[np - 1];
+    iy_trans_new = tot_tra_space;
   else
-    iy_transmittance_mult(iy_trans_new, iy_transmittance, Tensor3{tot_tra[np - 1]});
+    iy_transmittance_mult(iy_trans_new, iy_transmittance, tot_tra_space);
 
   // iy_aux: Optical depth
   if (auxOptDepth >= 0)
     for (Index iv = 0; iv < nf; iv++)
-      iy_aux[auxOptDepth](iv, 0) = -std::log(tot_tra[np - 1](iv, 0, 0));
+      iy_aux[auxOptDepth](iv, 0) = -std::log(tot_tra_space(iv, 0, 0));
 
   // Radiative background
   get_iy_of_background(ws,
@@ -1717,10 +1788,18 @@ void iyEmissionStandard(
                        iy_agenda_call1,
                        verbosity);
 
-  lvl_rad[np - 1] = iy;
-
   // Radiative transfer calculations
-  if (rt_integration_option == "first order" || rt_integration_option == "default") {
+  if (scalar_rt) {
+    lvl_rad_scl(np - 1, joker) = iy(joker, 0);
+    for (Index ip = np - 2; ip >= 0; ip--) {
+      lvl_rad_scl(ip, joker) = lvl_rad_scl(ip + 1, joker);
+      update_scalar_radiation(lvl_rad_scl(ip, joker),
+                              src_rad_scl(ip, joker),
+                              src_rad_scl(ip + 1, joker),
+                              lyr_tra_scl(ip + 1, joker));
+    }
+  } else if (rt_integration_option == "first order" || rt_integration_option == "default") {
+    lvl_rad[np - 1] = iy;
     for (Index ip = np - 2; ip >= 0; ip--) {
       lvl_rad[ip] = lvl_rad[ip + 1];
       update_radiation_vector(lvl_rad[ip],
@@ -1746,6 +1825,7 @@ void iyEmissionStandard(
                               RadiativeTransferSolver::Emission);
     }
   } else if (rt_integration_option == "second order") {
+    lvl_rad[np - 1] = iy;
     for (Index ip = np - 2; ip >= 0; ip--) {
       lvl_rad[ip] = lvl_rad[ip + 1];
       update_radiation_vector(lvl_rad[ip],
@@ -1776,7 +1856,16 @@ void iyEmissionStandard(
   }
 
   // Copy back to ARTS external style
-  iy = lvl_rad[0];
+  if (scalar_rt) {
+    iy(joker, 0) = lvl_rad_scl(0, joker);
+    for (Index ip = 0; ip < np; ip++) {
+      ppvar_trans_cumulat(ip, joker, 0, 0) = tot_tra_scl(ip, joker);
+      ppvar_trans_partial(ip, joker, 0, 0) = lyr_tra_scl(ip, joker);
+      ppvar_iy(joker, 0, ip) = lvl_rad_scl(ip, joker);
+    }
+  } else {
+    iy = lvl_rad[0];
+  }
   for (Index ip = 0; ip < lvl_rad.nelem(); ip++) {
     ppvar_trans_cumulat(ip, joker, joker, joker) = tot_tra[ip];
     ppvar_trans_partial(ip, joker, joker, joker) = lyr_tra[ip];
@@ -1821,6 +1910,208 @@ void iyEmissionStandard(
   }
 }
 
+/* Workspace method: Doxygen documentation will be auto-generated */
+void iyEmissionStandard(
+    Workspace& ws,
+    Matrix& iy,
+    ArrayOfMatrix& iy_aux,
+    ArrayOfTensor3& diy_dx,
+    Vector& ppvar_p,
+    Vector& ppvar_t,
+    EnergyLevelMap& ppvar_nlte,
+    Matrix& ppvar_vmr,
+    Matrix& ppvar_wind,
+    Matrix& ppvar_mag,
+    Matrix& ppvar_f,
+    Tensor3& ppvar_iy,
+    Tensor4& ppvar_trans_cumulat,
+    Tensor4& ppvar_trans_partial,
+    const Index& iy_id,
+    const Index& stokes_dim,
+    const Vector& f_grid,
+    const Index& atmosphere_dim,
+    const Vector& p_grid,
+    const Tensor3& t_field,
+    const EnergyLevelMap& nlte_field,
+    const Tensor4& vmr_field,
+    const ArrayOfArrayOfSpeciesTag& abs_species,
+    const Tensor3& wind_u_field,
+    const Tensor3& wind_v_field,
+    const Tensor3& wind_w_field,
+    const Tensor3& mag_u_field,
+    const Tensor3& mag_v_field,
+    const Tensor3& mag_w_field,
+    const Index& cloudbox_on,
+    const String& iy_unit,
+    const ArrayOfString& iy_aux_vars,
+    const Index& jacobian_do,
+    const ArrayOfRetrievalQuantity& jacobian_quantities,
+    const Ppath& ppath,
+    const Vector& rte_pos2,
+    const Agenda& propmat_clearsky_agenda,
+    const Agenda& water_p_eq_agenda,
+    const String& rt_integration_option,
+    const Agenda& iy_main_agenda,
+    const Agenda& iy_space_agenda,
+    const Agenda& iy_surface_agenda,
+    const Agenda& iy_cloudbox_agenda,
+    const Index& iy_agenda_call1,
+    const Tensor3& iy_transmittance,
+    const Numeric& rte_alonglos_v,
+    const Tensor3& surface_props_data,
+    const Verbosity& verbosity) {
+  iy_emission_standard_internal(ws,
+                                iy,
+                                iy_aux,
+                                diy_dx,
+                                ppvar_p,
+                                ppvar_t,
+                                ppvar_nlte,
+                                ppvar_vmr,
+                                ppvar_wind,
+                                ppvar_mag,
+                                ppvar_f,
+                                ppvar_iy,
+                                ppvar_trans_cumulat,
+                                ppvar_trans_partial,
+                                iy_id,
+                                stokes_dim,
+                                f_grid,
+                                atmosphere_dim,
+                                p_grid,
+                                t_field,
+                                nlte_field,
+                                vmr_field,
+                                abs_species,
+                                wind_u_field,
+                                wind_v_field,
+                                wind_w_field,
+                                mag_u_field,
+                                mag_v_field,
+                                mag_w_field,
+                                cloudbox_on,
+                                iy_unit,
+                                iy_aux_vars,
+                                jacobian_do,
+                                jacobian_quantities,
+                                ppath,
+                                rte_pos2,
+                                propmat_clearsky_agenda,
+                                false,
+                                water_p_eq_agenda,
+                                rt_integration_option,
+                                iy_main_agenda,
+                                iy_space_agenda,
+                                iy_surface_agenda,
+                                iy_cloudbox_agenda,
+                                iy_agenda_call1,
+                                iy_transmittance,
+                                rte_alonglos_v,
+                                surface_props_data,
+                                verbosity);
+}
+
+/* Workspace method: Doxygen documentation will be auto-generated */
+void iyEmissionStandardPpvarPropmatAgenda(
+    Workspace& ws,
+    Matrix& iy,
+    ArrayOfMatrix& iy_aux,
+    ArrayOfTensor3& diy_dx,
+    Vector& ppvar_p,
+    Vector& ppvar_t,
+    EnergyLevelMap& ppvar_nlte,
+    Matrix& ppvar_vmr,
+    Matrix& ppvar_wind,
+    Matrix& ppvar_mag,
+    Matrix& ppvar_f,
+    Tensor3& ppvar_iy,
+    Tensor4& ppvar_trans_cumulat,
+    Tensor4& ppvar_trans_partial,
+    const Index& iy_id,
+    const Index& stokes_dim,
+    const Vector& f_grid,
+    const Index& atmosphere_dim,
+    const Vector& p_grid,
+    const Tensor3& t_field,
+    const EnergyLevelMap& nlte_field,
+    const Tensor4& vmr_field,
+    const ArrayOfArrayOfSpeciesTag& abs_species,
+    const Tensor3& wind_u_field,
+    const Tensor3& wind_v_field,
+    const Tensor3& wind_w_field,
+    const Tensor3& mag_u_field,
+    const Tensor3& mag_v_field,
+    const Tensor3& mag_w_field,
+    const Index& cloudbox_on,
+    const String& iy_unit,
+    const ArrayOfString& iy_aux_vars,
+    const Index& jacobian_do,
+    const ArrayOfRetrievalQuantity& jacobian_quantities,
+    const Ppath& ppath,
+    const Vector& rte_pos2,
+    const Agenda& ppvar_propmat_agenda,
+    const Agenda& water_p_eq_agenda,
+    const String& rt_integration_option,
+    const Agenda& iy_main_agenda,
+    const Agenda& iy_space_agenda,
+    const Agenda& iy_surface_agenda,
+    const Agenda& iy_cloudbox_agenda,
+    const Index& iy_agenda_call1,
+    const Tensor3& iy_transmittance,
+    const Numeric& rte_alonglos_v,
+    const Tensor3& surface_props_data,
+    const Verbosity& verbosity) {
+  iy_emission_standard_internal(ws,
+                                iy,
+                                iy_aux,
+                                diy_dx,
+                                ppvar_p,
+                                ppvar_t,
+                                ppvar_nlte,
+                                ppvar_vmr,
+                                ppvar_wind,
+                                ppvar_mag,
+                                ppvar_f,
+                                ppvar_iy,
+                                ppvar_trans_cumulat,
+                                ppvar_trans_partial,
+                                iy_id,
+                                stokes_dim,
+                                f_grid,
+                                atmosphere_dim,
+                                p_grid,
+                                t_field,
+                                nlte_field,
+                                vmr_field,
+                                abs_species,
+                                wind_u_field,
+                                wind_v_field,
+                                wind_w_field,
+                                mag_u_field,
+                                mag_v_field,
+                                mag_w_field,
+                                cloudbox_on,
+                                iy_unit,
+                                iy_aux_vars,
+                                jacobian_do,
+                                jacobian_quantities,
+                                ppath,
+                                rte_pos2,
+                                ppvar_propmat_agenda,
+                                true,
+                                water_p_eq_agenda,
+                                rt_integration_option,
+                                iy_main_agenda,
+                                iy_space_agenda,
+                                iy_surface_agenda,
+                                iy_cloudbox_agenda,
+                                iy_agenda_call1,
+                                iy_transmittance,
+                                rte_alonglos_v,
+                                surface_props_data,
+                                verbosity);
+}
+
 /* Workspace method: Doxygen documentation will be auto-generated */
 void iyIndependentBeamApproximation(Workspace& ws,
                                     Matrix& iy,
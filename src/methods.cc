@@ -2061,6 +2061,35 @@ For "ByLine", the negative frequency is at F0-cutoff-D0
                "A flag with value 1 or 0. If set to one, the gridnames of"
                " every *atm_fields_compact* are checked.")));
 
+  md_data_raw.push_back(create_mdrecord(
+      NAME("abs_lookupSetStorage"),
+      DESCRIPTION(
+          "Changes the storage precision of the lookup table cross sections.\n"
+          "\n"
+          "The possible options are:\n"
+          "\n"
+          "- \"Double\": Full precision, the default of a calculated table.\n"
+          "- \"Float\": Single precision, half the memory of \"Double\".\n"
+          "- \"Log16\": The logarithm of the cross sections quantized to 16 bits\n"
+          "  separately for every spectrum, a quarter of the memory of \"Double\".\n"
+          "  Negative cross sections are stored as zero.\n"
+          "\n"
+          "The reduced precision tables are used directly by the lookup table\n"
+          "extraction, and are written and read in the reduced form. The largest\n"
+          "relative error that a reduced precision introduces to the positive\n"
+          "cross sections is reported on verbosity level 2. Converting back to\n"
+          "\"Double\" does not recover the lost precision.\n"),
+      AUTHORS("ARTS Developers"),
+      OUT("abs_lookup"),
+      GOUT(),
+      GOUT_TYPE(),
+      GOUT_DESC(),
+      IN("abs_lookup"),
+      GIN("storage"),
+      GIN_TYPE("String"),
+      GIN_DEFAULT(NODEF),
+      GIN_DESC("Storage option, see above.")));
+
   md_data_raw.push_back(create_mdrecord(
       NAME("abs_lookupSetupWide"),
       DESCRIPTION(
@@ -4471,6 +4500,22 @@ R"(
           "   *doit_rte_agenda*.\n"
           "3. Convergence test using *doit_conv_test_agenda*.\n"
           "\n"
+          "The iteration can be accelerated for optically thick clouds,\n"
+          "either by Ng-Acceleration every fourth iteration (``accelerated``)\n"
+          "or by Anderson mixing after every iteration (``anderson_depth``).\n"
+          "The latter treats steps 1 and 2 as a fixed-point map and\n"
+          "combines the last iterations to minimize the change between\n"
+          "the input and output fields, the quantity tested by the\n"
+          "convergence test, such as *doit_conv_flagAbs*.  The iteration\n"
+          "count is reported by the convergence test as usual.\n"
+          "\n"
+          "The geometry and clear-sky absorption of the radiative transfer\n"
+          "steps of *cloudbox_fieldUpdateSeq1D* are calculated in the first\n"
+          "iteration and reused in the following ones.  They are calculated\n"
+          "anew for another frequency, cloudbox or *za_grid*, but the agendas\n"
+          "must not change the atmosphere, e.g., *t_field*, *vmr_field* or\n"
+          "*pnd_field*, nor the values of *za_grid* while iterating.\n"
+          "\n"
           "Note:\n"
           "      The atmospheric dimensionality *atmosphere_dim* can be\n"
           "      either 1 or 3. To these dimensions the method adapts\n"
@@ -4485,11 +4530,12 @@ R"(
          "doit_scat_field_agenda",
          "doit_rte_agenda",
          "doit_conv_test_agenda"),
-      GIN("accelerated"),
-      GIN_TYPE("Index"),
-      GIN_DEFAULT("0"),
+      GIN("accelerated", "anderson_depth"),
+      GIN_TYPE("Index", "Index"),
+      GIN_DEFAULT("0", "0"),
       GIN_DESC(
-          "Index wether to accelerate only the intensity (1) or the whole Stokes Vector (4)")));
+          "Index wether to accelerate only the intensity (1) or the whole Stokes Vector (4)",
+          "Number of previous iterations combined by Anderson acceleration, 0 for none")));
 
   md_data_raw.push_back(create_mdrecord(
       NAME("cloudbox_fieldCrop"),
@@ -4750,7 +4796,13 @@ R"(
           "This method loops through the cloudbox to update the\n"
           "radiation field for all positions and directions in the 1D\n"
           "cloudbox. The method applies the sequential update. For more\n"
-          "information refer to AUG.\n"),
+          "information refer to AUG.\n"
+          "\n"
+          "Inside *cloudbox_field_monoIterate*, the propagation path steps,\n"
+          "the gas and particle absorption and the transmission along them\n"
+          "are calculated in the first iteration only. Later iterations\n"
+          "only update the radiances. Hence, *propmat_clearsky_agenda*,\n"
+          "*ppath_step_agenda* and *spt_calc_agenda* are then not executed.\n"),
       AUTHORS("Claudia Emde"),
       OUT("cloudbox_field_mono", "doit_scat_field"),
       GOUT(),
@@ -8541,6 +8593,74 @@ R"(
       GIN_DEFAULT(),
       GIN_DESC()));
 
+  md_data_raw.push_back(create_mdrecord(
+      NAME("iyEmissionStandardPpvarPropmatAgenda"),
+      DESCRIPTION(
+          "As *iyEmissionStandard*, but with absorption from *ppvar_propmat_agenda*.\n"
+          "\n"
+          "The propagation matrices of all points of *ppath* are calculated by\n"
+          "one execution of *ppvar_propmat_agenda*, instead of by executing\n"
+          "*propmat_clearsky_agenda* once per point. This removes the per point\n"
+          "agenda overhead and lets the absorption methods of the agenda share\n"
+          "work between the points, see for example *ppvar_propmatAddFromLookup*.\n"
+          "\n"
+          "The results are otherwise the same as for *iyEmissionStandard*.\n"),
+      AUTHORS("ARTS Developers"),
+      OUT("iy",
+          "iy_aux",
+          "diy_dx",
+          "ppvar_p",
+          "ppvar_t",
+          "ppvar_nlte",
+          "ppvar_vmr",
+          "ppvar_wind",
+          "ppvar_mag",
+          "ppvar_f",
+          "ppvar_iy",
+          "ppvar_trans_cumulat",
+          "ppvar_trans_partial"),
+      GOUT(),
+      GOUT_TYPE(),
+      GOUT_DESC(),
+      IN("diy_dx",
+         "iy_id",
+         "stokes_dim",
+         "f_grid",
+         "atmosphere_dim",
+         "p_grid",
+         "t_field",
+         "nlte_field",
+         "vmr_field",
+         "abs_species",
+         "wind_u_field",
+         "wind_v_field",
+         "wind_w_field",
+         "mag_u_field",
+         "mag_v_field",
+         "mag_w_field",
+         "cloudbox_on",
+         "iy_unit",
+         "iy_aux_vars",
+         "jacobian_do",
+         "jacobian_quantities",
+         "ppath",
+         "rte_pos2",
+         "ppvar_propmat_agenda",
+         "water_p_eq_agenda",
+         "rt_integration_option",
+         "iy_main_agenda",
+         "iy_space_agenda",
+         "iy_surface_agenda",
+         "iy_cloudbox_agenda",
+         "iy_agenda_call1",
+         "iy_transmittance",
+         "rte_alonglos_v",
+         "surface_props_data"),
+      GIN(),
+      GIN_TYPE(),
+      GIN_DEFAULT(),
+      GIN_DESC()));
+
   /*
   md_data_raw.push_back
     ( create_mdrecord
@@ -11737,7 +11857,13 @@ R"(
           "\n"
           "Only \"1\" and \"RJBT\" are allowed for *iy_unit*. The value of\n"
           "*mc_error* follows the selection for *iy_unit* (both for in- and\n"
-          "output.\n"),
+          "output.\n"
+          "\n"
+          "Photons are traced in parallel when the method is not called from\n"
+          "a parallel region. Every photon has its own random number stream\n"
+          "derived from *mc_seed*, and photons are summed in a fixed order,\n"
+          "so the result does not depend on the number of threads unless\n"
+          "the calculation is stopped by *mc_max_time*.\n"),
       AUTHORS("Cory Davis"),
       OUT("y",
           "mc_iteration_count",
@@ -13858,6 +13984,102 @@ R"(
       GIN_DEFAULT(),
       GIN_DESC()));
 
+  md_data_raw.push_back(create_mdrecord(
+      NAME("ppvar_propmatAddFromLookup"),
+      DESCRIPTION(
+          "Extract gas absorption coefficients from lookup table for all points\n"
+          "of the propagation path.\n"
+          "\n"
+          "As *propmat_clearskyAddFromLookup*, but the absorption of all ppath\n"
+          "points is extracted in one go and added to *ppvar_propmat*. The table\n"
+          "checks and the frequency interpolation are then only done once, as long\n"
+          "as all points share the same frequencies in *ppvar_f*, i.e., there is\n"
+          "no Doppler shift. Otherwise the points are extracted one by one.\n"
+          "\n"
+          "This method must be used inside *ppvar_propmat_agenda*, after\n"
+          "*ppvar_propmatInit*.\n"),
+      AUTHORS("ARTS Developers"),
+      OUT("ppvar_propmat", "ppvar_dpropmat"),
+      GOUT(),
+      GOUT_TYPE(),
+      GOUT_DESC(),
+      IN("ppvar_propmat",
+         "ppvar_dpropmat",
+         "abs_lookup",
+         "abs_lookup_is_adapted",
+         "abs_p_interp_order",
+         "abs_t_interp_order",
+         "abs_nls_interp_order",
+         "abs_f_interp_order",
+         "ppvar_f",
+         "ppvar_p",
+         "ppvar_t",
+         "ppvar_vmr",
+         "jacobian_quantities",
+         "abs_species"),
+      GIN("extpolfac","no_negatives"),
+      GIN_TYPE("Numeric","Index"),
+      GIN_DEFAULT("0.5","1"),
+      GIN_DESC("Extrapolation factor (for temperature and VMR grid edges).",
+               "Boolean. If it is true negative values due to interpolation "
+               "are set to zero.")));
+
+  md_data_raw.push_back(create_mdrecord(
+      NAME("ppvar_propmatCalc"),
+      DESCRIPTION(
+          "Calculates *ppvar_propmat* and *ppvar_nlte_source* point by point.\n"
+          "\n"
+          "Executes *propmat_clearsky_agenda* for each point of *ppath*. This is\n"
+          "what the radiative transfer methods using *propmat_clearsky_agenda*\n"
+          "do internally, and allows any absorption setup to be used in\n"
+          "*ppvar_propmat_agenda*.\n"),
+      AUTHORS("ARTS Developers"),
+      OUT("ppvar_propmat",
+          "ppvar_nlte_source",
+          "ppvar_dpropmat",
+          "ppvar_dnlte_source"),
+      GOUT(),
+      GOUT_TYPE(),
+      GOUT_DESC(),
+      IN("propmat_clearsky_agenda",
+         "jacobian_quantities",
+         "ppvar_f",
+         "ppvar_mag",
+         "ppath",
+         "ppvar_p",
+         "ppvar_t",
+         "ppvar_nlte",
+         "ppvar_vmr"),
+      GIN(),
+      GIN_TYPE(),
+      GIN_DEFAULT(),
+      GIN_DESC()));
+
+  md_data_raw.push_back(create_mdrecord(
+      NAME("ppvar_propmatInit"),
+      DESCRIPTION(
+          "Initialize *ppvar_propmat*, *ppvar_nlte_source*, and their derivatives\n"
+          "to zeroes.\n"
+          "\n"
+          "There is one element per point of the propagation path, each sized as\n"
+          "by *propmat_clearskyInit* for the frequencies of the point in *ppvar_f*.\n"
+          "\n"
+          "This method must be used inside *ppvar_propmat_agenda* and then be\n"
+          "called first.\n"),
+      AUTHORS("ARTS Developers"),
+      OUT("ppvar_propmat",
+          "ppvar_nlte_source",
+          "ppvar_dpropmat",
+          "ppvar_dnlte_source"),
+      GOUT(),
+      GOUT_TYPE(),
+      GOUT_DESC(),
+      IN("jacobian_quantities", "ppvar_f", "stokes_dim"),
+      GIN(),
+      GIN_TYPE(),
+      GIN_DEFAULT(),
+      GIN_DESC()));
+
   md_data_raw.push_back(
       create_mdrecord(NAME("Print"),
                DESCRIPTION("Prints a variable on the screen.\n"),
@@ -14216,6 +14438,11 @@ Valid speed-up logic other than "None" includes:
 
 Please use *sparse_f_gridFromFrequencyGrid* to see the sparse frequency grid
 
+If *lbl_cache_size* is positive, the line parameters of each band are kept
+for that many of the most recent atmospheric states.  Repeated calls for the
+same atmosphere then skip the evaluation of the line shape parameters, the
+partition functions, and the line strengths.
+
 By default we discourage negative values, which are common when using one of the line mixing
 approximations.   Change the value of no_negatives to 0 to allow these negative absorptions.
 )--"
@@ -14240,7 +14467,8 @@ approximations.   Change the value of no_negatives to 0 to allow these negative
          "rtp_nlte",
          "rtp_vmr",
          "nlte_do",
-         "lbl_checked"),
+         "lbl_checked",
+         "lbl_cache_size"),
       GIN("lines_sparse_df", "lines_sparse_lim", "lines_speedup_option", "no_negatives"),
       GIN_TYPE("Numeric", "Numeric", "String", "Index"),
       GIN_DEFAULT("0", "0", "None", "1"),
@@ -24335,6 +24563,35 @@ Options are:
                       USES_TEMPLATES(false),
                       PASSWORKSPACE(true)));
 
+  md_data_raw.push_back(
+      create_mdrecord(NAME("ppvar_propmat_agendaSet"),
+                      DESCRIPTION(R"--(Sets *ppvar_propmat_agenda* to a default value
+
+Options are:
+
+- ``"FromPropmatClearskyAgenda"``:
+
+    1. Uses *ppvar_propmatCalc* to set *ppvar_propmat*, *ppvar_nlte_source*, *ppvar_dpropmat*, and *ppvar_dnlte_source* by *propmat_clearsky_agenda*
+- ``"FromLookup"``:
+
+    1. Uses *ppvar_propmatInit* to set *ppvar_propmat*, *ppvar_nlte_source*, *ppvar_dpropmat*, and *ppvar_dnlte_source*
+    2. Uses *ppvar_propmatAddFromLookup* to modify *ppvar_propmat* and *ppvar_dpropmat*
+)--"),
+                      AUTHORS("ARTS Developers"),
+                      OUT("ppvar_propmat_agenda"),
+                      GOUT(),
+                      GOUT_TYPE(),
+                      GOUT_DESC(),
+                      IN(),
+                      GIN("option"),
+                      GIN_TYPE("String"),
+                      GIN_DEFAULT(NODEF),
+                      GIN_DESC("Default agenda option (see description)"),
+                      SETMETHOD(false),
+                      AGENDAMETHOD(false),
+                      USES_TEMPLATES(false),
+                      PASSWORKSPACE(true)));
+
   md_data_raw.push_back(
       create_mdrecord(NAME("propmat_clearsky_agendaSet"),
                       DESCRIPTION(R"--(Sets *propmat_clearsky_agenda* to a default value
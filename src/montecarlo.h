@@ -268,7 +268,7 @@ void mcPathTraceGeneral(Workspace& ws,
                         Vector& abs_vec_mono,
                         Numeric& temperature,
                         MatrixView ext_mat_mono,
-                        RandomNumberGenerator<>& rng,
+                        RandomNumberStream<>& rng,
                         Vector& rte_pos,
                         Vector& rte_los,
                         Vector& pnd_vec,
@@ -357,7 +357,7 @@ void mcPathTraceRadar(Workspace& ws,
                       Vector& abs_vec_mono,
                       Numeric& temperature,
                       MatrixView ext_mat_mono,
-                      RandomNumberGenerator<>& rng,
+                      RandomNumberStream<>& rng,
                       Vector& rte_pos,
                       Vector& rte_los,
                       Vector& pnd_vec,
@@ -414,7 +414,7 @@ void mcPathTraceRadar(Workspace& ws,
 void Sample_los(VectorView new_rte_los,
                 Numeric& g_los_csc_theta,
                 MatrixView Z,
-                RandomNumberGenerator<>& rng,
+                RandomNumberStream<>& rng,
                 ConstVectorView rte_los,
                 const ArrayOfArrayOfSingleScatteringData& scat_data,
                 const Index stokes_dim,
@@ -435,6 +435,6 @@ void Sample_los(VectorView new_rte_los,
  * @author     *** FIXMEDOC ***
  * @date       *** FIXMEDOC ***
  */
-void Sample_los_uniform(VectorView new_rte_los, RandomNumberGenerator<>& rng);
+void Sample_los_uniform(VectorView new_rte_los, RandomNumberStream<>& rng);
 
 #endif  // montecarlo_h
@@ -43,7 +43,49 @@ void nca_read_from_file(const int ncid, GasAbsLookup& gal, const Verbosity&) {
   nca_get_data(ncid, "t_ref", gal.t_ref, true);
   nca_get_data(ncid, "t_pert", gal.t_pert, true);
   nca_get_data(ncid, "nls_pert", gal.nls_pert, true);
-  nca_get_data(ncid, "xsec", gal.xsec, true);
+
+  // Tables in reduced precision have a storage attribute
+  int retval;
+  size_t storage_len;
+  gal.xsec_compact = CompactCrossSections{};
+  if (nc_inq_attlen(ncid, NC_GLOBAL, "xsec_storage", &storage_len) == NC_NOERR) {
+    std::string storage(storage_len, '\0');
+    if ((retval = nc_get_att_text(ncid, NC_GLOBAL, "xsec_storage", storage.data())))
+      nca_error(retval, "nc_get_att_text");
+    gal.xsec_compact.storage = toGasAbsLookupStorageOrThrow(storage);
+  }
+
+  if (gal.xsec_compact.storage == GasAbsLookupStorage::Double) {
+    nca_get_data(ncid, "xsec", gal.xsec, true);
+    return;
+  }
+
+  CompactCrossSections& ccs = gal.xsec_compact;
+  gal.xsec = Tensor4{};
+  ccs.shape = {nca_get_dim(ncid, "xsec_nbooks"),
+               nca_get_dim(ncid, "xsec_npages"),
+               nca_get_dim(ncid, "xsec_nrows"),
+               nca_get_dim(ncid, "xsec_ncols")};
+  const Index n = ccs.shape[0] * ccs.shape[1] * ccs.shape[2] * ccs.shape[3];
+
+  int varid;
+  if ((retval = nc_inq_varid(ncid, "xsec", &varid)))
+    nca_error(retval, "nc_inq_varid(xsec)");
+
+  if (ccs.storage == GasAbsLookupStorage::Log16) {
+    ccs.q16.resize(n);
+    if ((retval = nc_get_var_ushort(ncid, varid, ccs.q16.data())))
+      nca_error(retval, "nc_get_var(xsec)");
+
+    ccs.log_offset.resize(ccs.shape[0], ccs.shape[1], ccs.shape[3]);
+    ccs.log_step.resize(ccs.shape[0], ccs.shape[1], ccs.shape[3]);
+    nca_get_data(ncid, "xsec_log_offset", ccs.log_offset.unsafe_data_handle());
+    nca_get_data(ncid, "xsec_log_step", ccs.log_step.unsafe_data_handle());
+  } else {
+    ccs.f32.resize(n);
+    if ((retval = nc_get_var_float(ncid, varid, ccs.f32.data())))
+      nca_error(retval, "nc_get_var(xsec)");
+  }
 }
 
 //! Writes a GasAbsLookup table to a NetCDF file
@@ -111,7 +153,46 @@ void nca_write_to_file(const int ncid,
   int t_ref_varid = nca_def_Vector(ncid, "t_ref", gal.t_ref);
   int t_pert_varid = nca_def_Vector(ncid, "t_pert", gal.t_pert);
   int nls_pert_varid = nca_def_Vector(ncid, "nls_pert", gal.nls_pert);
-  int xsec_varid = nca_def_Tensor4(ncid, "xsec", gal.xsec);
+
+  // Tables in reduced precision store xsec in a smaller type, with the
+  // same dimensions as a Tensor4
+  const CompactCrossSections& ccs = gal.xsec_compact;
+  int xsec_varid = -1, xsec_log_offset_varid = -1, xsec_log_step_varid = -1;
+  if (gal.Storage() == GasAbsLookupStorage::Double) {
+    xsec_varid = nca_def_Tensor4(ncid, "xsec", gal.xsec);
+  } else {
+    const String storage{toString(gal.Storage())};
+    if ((retval = nc_put_att_text(
+             ncid, NC_GLOBAL, "xsec_storage", storage.size(), storage.c_str())))
+      nca_error(retval, "nc_put_att_text");
+
+    std::array<int, 4> ncdims;
+    nca_def_dim(ncid, "xsec_nbooks", ccs.shape[0], &ncdims[0]);
+    nca_def_dim(ncid, "xsec_npages", ccs.shape[1], &ncdims[1]);
+    nca_def_dim(ncid, "xsec_nrows", ccs.shape[2], &ncdims[2]);
+    nca_def_dim(ncid, "xsec_ncols", ccs.shape[3], &ncdims[3]);
+
+    if (gal.Storage() == GasAbsLookupStorage::Log16) {
+      nca_def_var(ncid, "xsec", NC_USHORT, 4, &ncdims[0], &xsec_varid);
+
+      // Offsets and steps are per [nbooks, npages, ncols]
+      const std::array<int, 3> slice_ncdims{ncdims[0], ncdims[1], ncdims[3]};
+      nca_def_var(ncid,
+                  "xsec_log_offset",
+                  NC_DOUBLE,
+                  3,
+                  &slice_ncdims[0],
+                  &xsec_log_offset_varid);
+      nca_def_var(ncid,
+                  "xsec_log_step",
+                  NC_DOUBLE,
+                  3,
+                  &slice_ncdims[0],
+                  &xsec_log_step_varid);
+    } else {
+      nca_def_var(ncid, "xsec", NC_FLOAT, 4, &ncdims[0], &xsec_varid);
+    }
+  }
 
   if ((retval = nc_enddef(ncid))) nca_error(retval, "nc_enddef");
 
@@ -133,7 +214,27 @@ void nca_write_to_file(const int ncid,
   nca_put_var(ncid, t_ref_varid, gal.t_ref);
   nca_put_var(ncid, t_pert_varid, gal.t_pert);
   nca_put_var(ncid, nls_pert_varid, gal.nls_pert);
-  nca_put_var(ncid, xsec_varid, gal.xsec);
+  switch (gal.Storage()) {
+    case GasAbsLookupStorage::Double:
+      nca_put_var(ncid, xsec_varid, gal.xsec);
+      break;
+    case GasAbsLookupStorage::Float:
+      if ((retval = nc_put_var_float(ncid, xsec_varid, ccs.f32.data())))
+        nca_error(retval, "nc_put_var");
+      break;
+    case GasAbsLookupStorage::Log16:
+      if ((retval = nc_put_var_ushort(ncid, xsec_varid, ccs.q16.data())))
+        nca_error(retval, "nc_put_var");
+      if ((retval = nc_put_var_double(
+               ncid, xsec_log_offset_varid, ccs.log_offset.unsafe_data_handle())))
+        nca_error(retval, "nc_put_var");
+      if ((retval = nc_put_var_double(
+               ncid, xsec_log_step_varid, ccs.log_step.unsafe_data_handle())))
+        nca_error(retval, "nc_put_var");
+      break;
+    case GasAbsLookupStorage::FINAL:
+      ARTS_ASSERT(false)
+  }
 }
 
 ////////////////////////////////////////////////////////////////////////////
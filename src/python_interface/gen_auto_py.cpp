@@ -877,6 +877,10 @@ void workspace_method_nongenerics(size_t n, const NameMaps& arts) {
     }
     os << '\n';
 
+    // The method runs without holding the GIL.  Python callbacks in agendas
+    // reacquire it in the pybind11 std::function wrapper
+    os << "  py::gil_scoped_release release_gil{};\n";
+
     // Arguments from Arts side
     has_any = false;
     os << "  " << method.name << '(';
@@ -1321,7 +1325,9 @@ void workspace_method_generics(size_t n, const NameMaps& arts) {
       if (pass_verbosity) method_os << ", arg" << counter << "_";
       method_os << ");";
 
-      const String method_call = method_os.str();
+      // See workspace_method_nongenerics() for releasing the GIL
+      const String method_call = var_string(
+          "{py::gil_scoped_release release_gil{}; ", method_os.str(), '}');
 
       if (allow_py_object_input and input_var_args.size()) {
         Index s = 4;
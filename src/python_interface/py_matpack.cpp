@@ -27,6 +27,51 @@ void test_correct_size(const std::vector<T>& x) {
   }
 }
 
+//! Contiguous NumPy array of T, other arrays are converted on the way in
+template <typename T>
+using numpy_array = py::array_t<T, py::array::c_style | py::array::forcecast>;
+
+/** Copy a NumPy array into a new matpack type in one pass
+ *
+ * The matpack types own their data, so the memory of the array cannot be
+ * adopted.  This is still much faster than going via nested lists.
+ *
+ * Arrays of other strides or numeric types are converted by NumPy first,
+ * but complex arrays are only accepted for complex types, as the imaginary
+ * part would otherwise be lost.
+ *
+ * @param in The array, must have rank N
+ * @return The new matpack data
+ */
+template <typename T, Index N>
+std::unique_ptr<matpack::matpack_data<T, N>> from_numpy(const py::array& in) {
+  ARTS_USER_ERROR_IF(in.ndim() != N,
+                     "Expected an array with ",
+                     N,
+                     " dimensions, got ",
+                     in.ndim())
+
+  constexpr bool is_complex = std::is_same_v<T, Complex>;
+  const char kind = in.dtype().kind();
+  ARTS_USER_ERROR_IF(kind == 'c' and not is_complex,
+                     "Cannot convert a complex array to a real type")
+  ARTS_USER_ERROR_IF(kind != 'b' and kind != 'i' and kind != 'u' and
+                         kind != 'f' and kind != 'c',
+                     "Cannot convert an array of dtype ",
+                     std::string(py::str(in.dtype())),
+                     " to numbers")
+
+  const auto arr = numpy_array<T>::ensure(in);
+  ARTS_USER_ERROR_IF(not arr, "Cannot convert the array")
+
+  std::array<Index, N> shape;
+  for (Index i = 0; i < N; i++) shape[i] = static_cast<Index>(arr.shape(i));
+
+  auto out = std::make_unique<matpack::matpack_data<T, N>>(shape);
+  std::copy(arr.data(), arr.data() + arr.size(), out->data_handle());
+  return out;
+}
+
 void py_matpack(py::module_& m) {
   py::class_<Range>(m, "Range")
       .def(py::init([](Index a, Index b, Index c) {
@@ -52,6 +97,9 @@ void py_matpack(py::module_& m) {
 
   py::class_<Vector>(m, "Vector", py::buffer_protocol())
       .def(py::init([]() { return std::make_unique<Vector>(); }), "Default vector")
+      .def(py::init(&from_numpy<Numeric, 1>),
+           py::arg("arr").none(false),
+           py::doc("From :class:`~numpy.ndarray`, copied in one pass"))
       .def(py::init([](const std::vector<Scalar>& v) {
              auto out = std::make_unique<Vector>(v.size());;
              for (size_t i = 0; i < v.size(); i++)
@@ -98,6 +146,9 @@ via x.value
 
   py::class_<Matrix>(m, "Matrix", py::buffer_protocol())
       .def(py::init([]() { return std::make_unique<Matrix>(); }), "Default matrix")
+      .def(py::init(&from_numpy<Numeric, 2>),
+           py::arg("arr").none(false),
+           py::doc("From :class:`~numpy.ndarray`, copied in one pass"))
       .def(py::init([](const std::vector<std::vector<Scalar>>& v) {
              test_correct_size(v);
              auto n1 = v.size();
@@ -156,6 +207,9 @@ via x.value
 
   py::class_<Tensor3>(m, "Tensor3", py::buffer_protocol())
       .def(py::init([]() { return std::make_unique<Tensor3>(); }), "Default tensor")
+      .def(py::init(&from_numpy<Numeric, 3>),
+           py::arg("arr").none(false),
+           py::doc("From :class:`~numpy.ndarray`, copied in one pass"))
       .def(py::init([](const std::vector<std::vector<std::vector<Scalar>>>& v) {
              test_correct_size(v);
              auto n1 = v.size();
@@ -217,6 +271,9 @@ via x.value
 
   py::class_<Tensor4>(m, "Tensor4", py::buffer_protocol())
       .def(py::init([]() { return std::make_unique<Tensor4>(); }), "Default tensor")
+      .def(py::init(&from_numpy<Numeric, 4>),
+           py::arg("arr").none(false),
+           py::doc("From :class:`~numpy.ndarray`, copied in one pass"))
       .def(py::init([](const std::vector<
                         std::vector<std::vector<std::vector<Scalar>>>>& v) {
              test_correct_size(v);
@@ -285,6 +342,9 @@ via x.value
 
   py::class_<Tensor5>(m, "Tensor5", py::buffer_protocol())
       .def(py::init([]() { return std::make_unique<Tensor5>(); }), "Default tensor")
+      .def(py::init(&from_numpy<Numeric, 5>),
+           py::arg("arr").none(false),
+           py::doc("From :class:`~numpy.ndarray`, copied in one pass"))
       .def(py::init([](const std::vector<std::vector<
                            std::vector<std::vector<std::vector<Scalar>>>>>& v) {
              test_correct_size(v);
@@ -359,6 +419,9 @@ via x.value
 
   py::class_<Tensor6>(m, "Tensor6", py::buffer_protocol())
       .def(py::init([]() { return std::make_unique<Tensor6>(); }), "Default tensor")
+      .def(py::init(&from_numpy<Numeric, 6>),
+           py::arg("arr").none(false),
+           py::doc("From :class:`~numpy.ndarray`, copied in one pass"))
       .def(
           py::init([](const std::vector<std::vector<std::vector<
                           std::vector<std::vector<std::vector<Scalar>>>>>>& v) {
@@ -441,6 +504,9 @@ via x.value
 
   py::class_<Tensor7>(m, "Tensor7", py::buffer_protocol())
       .def(py::init([]() { return std::make_unique<Tensor7>(); }), "Default tensor")
+      .def(py::init(&from_numpy<Numeric, 7>),
+           py::arg("arr").none(false),
+           py::doc("From :class:`~numpy.ndarray`, copied in one pass"))
       .def(py::init(
                [](const std::vector<std::vector<std::vector<std::vector<
                       std::vector<std::vector<std::vector<Scalar>>>>>>>& v) {
@@ -531,6 +597,14 @@ The data can be accessed without copy using ``np.array(x, copy=False)`` or
 via x.value
 )--");
 
+  py::implicitly_convertible<py::array, Vector>();
+  py::implicitly_convertible<py::array, Matrix>();
+  py::implicitly_convertible<py::array, Tensor3>();
+  py::implicitly_convertible<py::array, Tensor4>();
+  py::implicitly_convertible<py::array, Tensor5>();
+  py::implicitly_convertible<py::array, Tensor6>();
+  py::implicitly_convertible<py::array, Tensor7>();
+
   py::implicitly_convertible<std::vector<Scalar>, Vector>();
   py::implicitly_convertible<std::vector<std::vector<Scalar>>, Matrix>();
   py::implicitly_convertible<std::vector<std::vector<std::vector<Scalar>>>, Tensor3>();
@@ -620,6 +694,9 @@ via x.value
 
   py::class_<ComplexVector>(m, "ComplexVector", py::buffer_protocol())
       .def(py::init([]() { return std::make_unique<ComplexVector>(); }), "Default vector")
+      .def(py::init(&from_numpy<Complex, 1>),
+           py::arg("arr").none(false),
+           py::doc("From :class:`~numpy.ndarray`, copied in one pass"))
       .PythonInterfaceCopyValue(ComplexVector)
       .PythonInterfaceBasicRepresentation(ComplexVector)
       .PythonInterfaceValueOperators.PythonInterfaceNumpyValueProperties
@@ -649,5 +726,7 @@ via x.value
           }))
       .doc() = R"--(Holds complex vector data.
 )--";
+
+  py::implicitly_convertible<py::array, ComplexVector>();
 }
 }  // namespace Python
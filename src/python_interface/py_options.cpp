@@ -57,6 +57,7 @@ void py_options(py::module_& m) {
   DeclareOption(Options, iy_cloudbox_agendaDefaultOptions)
   DeclareOption(Options, ppath_agendaDefaultOptions)
   DeclareOption(Options, ppath_step_agendaDefaultOptions)
+  DeclareOption(Options, ppvar_propmat_agendaDefaultOptions)
   DeclareOption(Options, refr_index_air_agendaDefaultOptions)
   DeclareOption(Options, water_p_eq_agendaDefaultOptions)
   DeclareOption(Options, gas_scattering_agendaDefaultOptions)
@@ -299,9 +299,17 @@ void py_rte(py::module_& m) {
       .PythonInterfaceBasicReferenceProperty(GasAbsLookup, t_pert, Tpert, Tpert, ":class:`~pyarts.arts.Vector` Temperature perturbations")
       .PythonInterfaceBasicReferenceProperty(
           GasAbsLookup, nls_pert, NLSPert, NLSPert, ":class:`~pyarts.arts.Vector` Non-linear perturbations")
-      .PythonInterfaceBasicReferenceProperty(GasAbsLookup, xsec, Xsec, Xsec, ":class:`~pyarts.arts.Tensor4` Cross-section data")
+      .def_property(
+          "xsec",
+          py::cpp_function(
+              [](GasAbsLookup& x) -> Tensor4& { return x.Xsec(); },
+              py::return_value_policy::reference_internal),
+          [](GasAbsLookup& x, Tensor4 y) { x.SetXsec(std::move(y)); },
+          py::doc(":class:`~pyarts.arts.Tensor4` Cross-section data"))
       .def(py::pickle(
           [](GasAbsLookup& self) {
+            ARTS_USER_ERROR_IF(self.Storage() != GasAbsLookupStorage::Double,
+                               "Can only pickle tables with Double storage")
             return py::make_tuple(self.Species(),
                                   self.NonLinearSpecies(),
                                   self.Fgrid(),
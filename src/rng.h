@@ -5,6 +5,8 @@
 #include "matpack_concepts.h"
 
 #include <algorithm>
+#include <array>
+#include <cstdint>
 #include <limits>
 #include <mutex>
 #include <ostream>
@@ -190,6 +192,149 @@ public:
   }
 };
 
+/** Counter-based Philox4x32-10 random bit generator
+ *
+ * Salmon et al. (2011), Parallel random numbers: as easy as 1, 2, 3.
+ *
+ * Each output block is a keyed bijection of a 128-bit counter, so the
+ * generator is cheap to construct, needs no locking, and the n:th number
+ * of a stream can be computed without computing the ones before it.  The
+ * seed is the key, and the upper half of the counter is the stream index,
+ * so two generators with the same seed but different streams, e.g., one
+ * per thread or per photon, give independent and reproducible sequences.
+ */
+class Philox4x32 {
+  static constexpr std::uint32_t M0 = 0xD2511F53;
+  static constexpr std::uint32_t M1 = 0xCD9E8D57;
+  static constexpr std::uint32_t W0 = 0x9E3779B9;
+  static constexpr std::uint32_t W1 = 0xBB67AE85;
+
+  std::array<std::uint32_t, 2> key;
+  std::array<std::uint32_t, 4> ctr;
+  std::array<std::uint32_t, 4> block{};
+  std::size_t pos{block.size()};
+
+  static constexpr std::array<std::uint32_t, 4> round(
+      const std::array<std::uint32_t, 4> &c,
+      const std::array<std::uint32_t, 2> &k) {
+    const std::uint64_t p0 = std::uint64_t{M0} * c[0];
+    const std::uint64_t p1 = std::uint64_t{M1} * c[2];
+    return {static_cast<std::uint32_t>(p1 >> 32) ^ c[1] ^ k[0],
+            static_cast<std::uint32_t>(p1),
+            static_cast<std::uint32_t>(p0 >> 32) ^ c[3] ^ k[1],
+            static_cast<std::uint32_t>(p0)};
+  }
+
+  //! Increments the lower half of the counter, i.e., within the stream
+  constexpr void increment() {
+    if (++ctr[0] == 0) ++ctr[1];
+  }
+
+public:
+  using result_type = std::uint32_t;
+
+  static constexpr result_type min() {
+    return std::numeric_limits<result_type>::lowest();
+  }
+
+  static constexpr result_type max() {
+    return std::numeric_limits<result_type>::max();
+  }
+
+  /** Construct a new Philox4x32 object
+   *
+   * @param seed The key of the generator
+   * @param stream The index of the stream of the generator
+   */
+  constexpr explicit Philox4x32(std::uint64_t seed = 0,
+                                std::uint64_t stream = 0)
+      : key{static_cast<std::uint32_t>(seed),
+            static_cast<std::uint32_t>(seed >> 32)},
+        ctr{0,
+            0,
+            static_cast<std::uint32_t>(stream),
+            static_cast<std::uint32_t>(stream >> 32)} {}
+
+  //! The 10-round Philox bijection of a counter with a key
+  static constexpr std::array<std::uint32_t, 4> generate(
+      std::array<std::uint32_t, 4> c, std::array<std::uint32_t, 2> k) {
+    for (int i = 0; i < 9; i++) {
+      c = round(c, k);
+      k[0] += W0;
+      k[1] += W1;
+    }
+    return round(c, k);
+  }
+
+  constexpr result_type operator()() {
+    if (pos == block.size()) {
+      block = generate(ctr, key);
+      increment();
+      pos = 0;
+    }
+    return block[pos++];
+  }
+
+  //! Skips n outputs of the stream without generating them
+  constexpr void discard(unsigned long long n) {
+    while (n > 0 and pos not_eq block.size()) {
+      ++pos;
+      --n;
+    }
+
+    for (unsigned long long i = 0; i < n / block.size(); i++) increment();
+
+    if (n % block.size()) {
+      block = generate(ctr, key);
+      increment();
+      pos = n % block.size();
+    }
+  }
+};
+
+/** A lock-free source of random numbers for a single thread or photon
+ *
+ * Unlike RandomNumberGenerator, get<>() draws from this object's own
+ * generator, so no new generator is seeded and no mutex is locked per
+ * call.  The callable returned by get<>() refers to this object and must
+ * not outlive it.  Create one object per thread or per photon, with the
+ * same seed and a unique stream index, to get independent sequences that
+ * do not depend on the scheduling of the threads.
+ *
+ * @tparam Generator A counter-based generator constructible from a seed and a stream index
+ */
+template <std::uniform_random_bit_generator Generator = Philox4x32>
+class RandomNumberStream {
+  Generator v;
+
+public:
+  /** Construct a new Random Number Stream object
+   *
+   * @param seed The seed, common to all streams of a calculation
+   * @param stream The unique index of this stream
+   */
+  RandomNumberStream(std::uint64_t seed, std::uint64_t stream)
+      : v(seed, stream) {}
+
+  /** Returns a random number generator of some random distribution
+   *
+   * See RandomNumberGenerator::get for the details
+   *
+   * @tparam random_distribution A random number distribution
+   * @param x The parameters to construct the random_distribution
+   * @return auto A callable generator of random numbers
+   */
+  template <template <typename>
+            class random_distribution = std::uniform_real_distribution,
+            typename... Ts>
+  auto get(Ts &&...x) {
+    return [this,
+            draw = random_distribution(std::forward<Ts>(x)...)]() mutable {
+      return draw(v);
+    };
+  }
+};
+
 /** Wraps the generation of a random number generator for a matpack type
  *
  * @tparam random_distribution As for RandomNumberGenerator::get
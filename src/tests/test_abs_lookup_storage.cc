@@ -0,0 +1,205 @@
+#include "arts.h"
+#include "debug.h"
+#include "gas_abs_lookup.h"
+#include "matpack_data.h"
+#include "species_tags.h"
+#include "xml_io.h"
+
+#ifdef ENABLE_NETCDF
+#include "nc_io.h"
+#endif
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+
+/** A table of two species with temperature perturbations
+ *
+ * The cross sections of the first species are positive.  Those of the
+ * second species are zero at the highest pressure, and change sign over
+ * frequency at the other pressures, as absorption with line mixing.
+ */
+GasAbsLookup test_table() {
+  constexpr Index nt = 3, ns = 2, nf = 21, np = 6;
+
+  GasAbsLookup gal;
+  gal.Species() = {ArrayOfSpeciesTag("H2O"), ArrayOfSpeciesTag("O2")};
+  gal.NonLinearSpecies() = {};
+  gal.Fgrid() = uniform_grid(100e9, nf, 5e9);
+  gal.Pgrid() = Vector{1e5, 5e4, 2e4, 1e4, 5e3, 2e3};
+  gal.VMRs() = Matrix(ns, np);
+  gal.VMRs()(0, joker) = Vector{1e-2, 5e-3, 1e-3, 1e-4, 1e-5, 1e-5};
+  gal.VMRs()(1, joker) = 0.21;
+  gal.Tref() = Vector{290, 270, 240, 220, 215, 220};
+  gal.Tpert() = Vector{-10, 0, 10};
+  gal.NLSPert() = {};
+
+  Tensor4 xsec(nt, ns, nf, np);
+  for (Index b = 0; b < nt; b++) {
+    for (Index r = 0; r < nf; r++) {
+      for (Index c = 0; c < np; c++) {
+        const Numeric x = static_cast<Numeric>(r) / static_cast<Numeric>(nf);
+        const Numeric t = 1.0 + 0.01 * static_cast<Numeric>(b);
+        const Numeric p = static_cast<Numeric>(np - c);
+        xsec(b, 0, r, c) = t * 1e-25 * p * std::exp(8 * x * p / np);
+        xsec(b, 1, r, c) = c == 0 ? 0.0 : t * 1e-27 * p * std::sin(6 * x + 1);
+      }
+    }
+  }
+  gal.SetXsec(xsec);
+
+  return gal;
+}
+
+/** The absorption of the table at the highest pressure and between its
+ * grid points
+ *
+ * The interpolation in pressure and temperature is linear, so that the
+ * relative error of the cross sections bounds the one of the absorption.
+ */
+Tensor3 extract(const GasAbsLookup& gal) {
+  const Vector p{1e5, 8e4, 3e4, 1.5e4, 2.5e3};
+  const Vector T{280, 282, 255, 230, 218};
+  Matrix vmrs(2, p.nelem());
+  vmrs(0, joker) = Vector{1e-2, 8e-3, 2e-3, 1e-4, 1e-5};
+  vmrs(1, joker) = 0.21;
+
+  Tensor3 sga;
+  gal.Extract(sga, {}, 1, 1, 1, 0, p, T, vmrs, gal.GetFgrid(), 0.5);
+  return sga;
+}
+
+//! The table with negative cross sections set to zero, as stored by Log16
+GasAbsLookup without_negatives(GasAbsLookup gal) {
+  Tensor4& xsec = gal.Xsec();
+  std::transform(xsec.elem_begin(), xsec.elem_end(), xsec.elem_begin(),
+                 [](Numeric x) { return std::max(x, 0.0); });
+  return gal;
+}
+
+/** Absorption of a compact table must be within tol of the original one
+ *
+ * tol is relative to the absolute value, for Float to the largest absolute
+ * value, of each species and point, as the absorption may change sign.
+ */
+void require_close(const Tensor3& compact,
+                   const Tensor3& ref,
+                   Numeric tol,
+                   bool relative_to_largest,
+                   const String& what) {
+  ARTS_USER_ERROR_IF(compact.npages() not_eq ref.npages() or
+                         compact.nrows() not_eq ref.nrows() or
+                         compact.ncols() not_eq ref.ncols(),
+                     what, ": different sizes")
+
+  for (Index ip = 0; ip < ref.npages(); ip++) {
+    for (Index is = 0; is < ref.nrows(); is++) {
+      const ConstVectorView x = ref(ip, is, joker);
+      const Numeric largest = std::abs(
+          *std::max_element(x.begin(), x.end(), [](auto a, auto b) {
+            return std::abs(a) < std::abs(b);
+          }));
+
+      for (Index iv = 0; iv < ref.ncols(); iv++) {
+        const Numeric scale =
+            relative_to_largest ? largest : std::abs(ref(ip, is, iv));
+        ARTS_USER_ERROR_IF(
+            std::abs(compact(ip, is, iv) - ref(ip, is, iv)) > tol * scale,
+            what, ": absorption of species ", is, " at point ", ip,
+            " and frequency ", iv, " is ", compact(ip, is, iv), " vs ",
+            ref(ip, is, iv))
+      }
+    }
+  }
+}
+
+/** The table read back must extract the absorption of the written one
+ *
+ * Exactly for binary files, within the precision of the text for ASCII.
+ */
+void require_same(const GasAbsLookup& read,
+                  const GasAbsLookup& written,
+                  Numeric tol,
+                  const String& what) {
+  ARTS_USER_ERROR_IF(read.Storage() not_eq written.Storage(),
+                     what, ": read ", read.Storage(), " storage, wrote ",
+                     written.Storage())
+  require_close(extract(read), extract(written), tol, false, what);
+}
+
+/** Compact tables must survive writing and reading unchanged
+ *
+ * Extraction from the tables read back must also agree with the double
+ * precision table within the documented accuracy of the storage.
+ */
+void test_storage_io() {
+  const Verbosity verbosity;
+
+  GasAbsLookup ref_table = test_table();
+  ref_table.Adapt(ref_table.Species(), ref_table.GetFgrid(), verbosity);
+  const Tensor3 ref = extract(ref_table);
+  const Tensor3 ref_log16 = extract(without_negatives(ref_table));
+
+  // The second species must have zero and negative absorption
+  ARTS_USER_ERROR_IF(std::none_of(ref.elem_begin(), ref.elem_end(),
+                                  [](Numeric x) { return x < 0; }) or
+                         std::none_of(ref.elem_begin(), ref.elem_end(),
+                                      [](Numeric x) { return x == 0; }),
+                     "The test table has no negative or zero absorption")
+
+  for (auto storage : {GasAbsLookupStorage::Float, GasAbsLookupStorage::Log16}) {
+    GasAbsLookup table = test_table();
+    const Numeric max_rel_error = table.SetStorage(storage);
+    std::cout << storage << " storage, largest relative error "
+              << max_rel_error << '\n';
+    table.Adapt(table.Species(), table.GetFgrid(), verbosity);
+
+    // Float keeps negative values with the precision of the largest
+    // absorption, Log16 keeps the positive ones within half a step of
+    // the logarithm, which is far less than 1e-3 for this table
+    if (storage == GasAbsLookupStorage::Float) {
+      ARTS_USER_ERROR_IF(max_rel_error > 1e-7,
+                         "Float storage error: ", max_rel_error)
+      require_close(extract(table), ref, 1e-7, true, "Float");
+    } else {
+      ARTS_USER_ERROR_IF(max_rel_error > 1e-3 or max_rel_error == 0,
+                         "Log16 storage error: ", max_rel_error)
+      require_close(
+          extract(table), ref_log16, max_rel_error * 1.000001, false, "Log16");
+    }
+
+    for (auto ftype : {FILE_TYPE_ASCII, FILE_TYPE_BINARY}) {
+      const String filename = var_string(
+          "test_abs_lookup_storage.", storage, '.', ftype, ".xml");
+      xml_write_to_file(filename, table, ftype, 0, verbosity);
+
+      GasAbsLookup read;
+      xml_read_from_file(filename, read, verbosity);
+      read.Adapt(read.Species(), read.GetFgrid(), verbosity);
+      require_same(
+          read, table, ftype == FILE_TYPE_ASCII ? 1e-12 : 0.0, filename);
+    }
+
+#ifdef ENABLE_NETCDF
+    {
+      const String filename =
+          var_string("test_abs_lookup_storage.", storage, ".nc");
+      nca_write_to_file(filename, table, verbosity);
+
+      GasAbsLookup read;
+      nca_read_from_file(filename, read, verbosity);
+      read.Adapt(read.Species(), read.GetFgrid(), verbosity);
+      require_same(read, table, 0.0, filename);
+    }
+#endif
+  }
+}
+
+int main() try {
+  test_storage_io();
+  return EXIT_SUCCESS;
+} catch (std::exception& e) {
+  std::cerr << e.what() << '\n';
+  return EXIT_FAILURE;
+}
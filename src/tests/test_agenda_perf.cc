@@ -0,0 +1,112 @@
+#include "agenda_record.h"
+#include "agenda_set.h"
+#include "arts.h"
+#include "artstime.h"
+#include "auto_md.h"
+#include "global_data.h"
+#include "matpack_data.h"
+#include "methods.h"
+#include "workspace.h"
+#include "workspace_ng.h"
+
+#include <cstdlib>
+#include <iostream>
+#include <ostream>
+#include <vector>
+
+struct Timing {
+  std::string_view name;
+  Timing(const char * c) : name(c) {}
+  TimeStep dt{};
+  template <typename Function> void operator()(Function&& f) {
+    Time start{};
+    f();
+    Time end{};
+    dt = end - start;
+  }
+};
+
+std::ostream& operator<<(std::ostream& os, const std::vector<Timing>& vt) {
+  for (auto& t: vt) if (t.name not_eq "dummy") os << t.name  << " : " << t.dt << '\n';
+  return os;
+}
+
+void init_global_data() {
+  define_wsv_groups();
+  define_wsv_data();
+  define_wsv_map();
+  define_md_data_raw();
+  expand_md_data_raw_to_md_data();
+  define_md_map();
+  define_md_raw_map();
+  define_agenda_data();
+  define_agenda_map();
+  global_data::workspace_memory_handler.initialize();
+}
+
+//! Compares a bare MatrixCBR call with executing it as the iy_space_agenda
+std::vector<Timing> test_iy_space_agenda(Workspace& ws, Index ncalls, Index nfreq) {
+  const Index stokes_dim = *ws.get<Index>("stokes_dim");
+  const Vector f_grid = uniform_grid(1e9, nfreq, 1e9);
+  const Vector rtp_pos(3, 0.0), rtp_los(2, 0.0);
+  const Verbosity verbosity;
+  Matrix iy;
+
+  const Agenda agenda = AgendaManip::get_iy_space_agenda(ws, "CosmicBackground");
+
+  std::vector<Timing> out;
+
+  out.emplace_back("MatrixCBR(iy, stokes_dim, f_grid)")([&]() {
+    for (Index i = 0; i < ncalls; i++) MatrixCBR(iy, stokes_dim, f_grid, verbosity);
+  });
+
+  out.emplace_back("iy_space_agendaExecute(ws, iy, f_grid, rtp_pos, rtp_los)")([&]() {
+    for (Index i = 0; i < ncalls; i++) iy_space_agendaExecute(ws, iy, f_grid, rtp_pos, rtp_los, agenda);
+  });
+
+  std::cout << "agenda overhead per call: "
+            << (out[1].dt - out[0].dt) / static_cast<Numeric>(ncalls) << '\n';
+
+  return out;
+}
+
+//! Compares the two ways of copying a workspace for a parallel region
+std::vector<Timing> test_workspace_copy(Workspace& ws, Index ncalls) {
+  const Index stokes_dim = ws.WsvMap_ptr->at("stokes_dim");
+  Index sum = 0;
+
+  std::vector<Timing> out;
+
+  out.emplace_back("ws.shallowcopy()")([&]() {
+    for (Index i = 0; i < ncalls; i++) sum += ws.shallowcopy()->depth(stokes_dim);
+  });
+
+  out.emplace_back("ws.fork()")([&]() {
+    for (Index i = 0; i < ncalls; i++) sum += ws.fork()->depth(stokes_dim);
+  });
+
+  std::cout << "copies with stokes_dim: " << sum << '\n';
+
+  return out;
+}
+
+int main(int argc, char** c) {
+  if (argc < 4) {
+    std::cerr << "Expects PROGNAME NREPEAT NCALLS NFREQ\n";
+    return EXIT_FAILURE;
+  }
+
+  const auto n = static_cast<Index>(std::atoll(c[1]));
+  const auto ncalls = static_cast<Index>(std::atoll(c[2]));
+  const auto nfreq = static_cast<Index>(std::atoll(c[3]));
+
+  init_global_data();
+  auto ws = Workspace::create();
+  ws->push_move(ws->WsvMap_ptr->at("verbosity"), std::make_shared<Verbosity>(0, 0, 0));
+  ws->push_move(ws->WsvMap_ptr->at("stokes_dim"), std::make_shared<Index>(1));
+
+  for (Index i=0; i<n; i++) {
+    std::cout << ncalls << " calls " << nfreq << " frequencies test_iy_space_agenda\n" << test_iy_space_agenda(*ws, ncalls, nfreq) << '\n';
+    std::cout << ncalls << " calls test_workspace_copy\n" << test_workspace_copy(*ws, ncalls) << '\n';
+  }
+}
@@ -0,0 +1,247 @@
+#include "arts_constants.h"
+#include "debug.h"
+#include "doit.h"
+#include "math_funcs.h"
+#include "matpack_data.h"
+#include "messages.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+/** Iterations needed to solve x = A x + b by the DOIT loop
+ *
+ * A is the tridiagonal matrix with 0.49 on the diagonal and 0.245 next to
+ * it, a contraction with spectral radius close to 0.98 as for an optically
+ * thick cloud.  The loop and the convergence test on the largest change of
+ * the field follow cloudbox_field_monoIterate and doit_conv_flagAbs, and
+ * the mixing is done by the same cloudbox_field_andersonUpdate.
+ */
+Index linear_fixed_point_iterations(Index anderson_depth) {
+  constexpr Index n = 40;
+  constexpr Numeric epsilon = 1e-8;
+  constexpr Index max_iterations = 10000;
+  const Verbosity verbosity;
+
+  const auto G = [](const Tensor6& x) {
+    Tensor6 y(n, 1, 1, 1, 1, 1);
+    const Numeric* xi = x.data_handle();
+    Numeric* yi = y.data_handle();
+    for (Index i = 0; i < n; i++) {
+      yi[i] = 1.0 + 0.49 * xi[i];
+      if (i > 0) yi[i] += 0.245 * xi[i - 1];
+      if (i < n - 1) yi[i] += 0.245 * xi[i + 1];
+    }
+    return y;
+  };
+
+  Tensor6 x(n, 1, 1, 1, 1, 1, 0.0);
+  ArrayOfTensor6 anderson_input, anderson_output;
+  for (Index iteration = 1; iteration <= max_iterations; iteration++) {
+    Tensor6 x_old = x;
+    x = G(x_old);
+
+    Numeric change = 0;
+    for (Index i = 0; i < n; i++) {
+      change = std::max(change,
+                        std::abs(x.data_handle()[i] - x_old.data_handle()[i]));
+    }
+    if (change < epsilon) {
+      const Numeric* xi = x.data_handle();
+      const Tensor6 y = G(x);
+      for (Index i = 0; i < n; i++) {
+        ARTS_USER_ERROR_IF(std::abs(y.data_handle()[i] - xi[i]) > 1e-6,
+                           "Not a fixed point at ", i)
+      }
+      return iteration;
+    }
+
+    if (anderson_depth > 0) {
+      cloudbox_field_andersonUpdate(x,
+                                    anderson_input,
+                                    anderson_output,
+                                    std::move(x_old),
+                                    anderson_depth,
+                                    verbosity);
+    }
+  }
+
+  ARTS_USER_ERROR("No convergence in ", max_iterations, " iterations")
+}
+
+//! Anderson mixing must need fewer iterations than the plain iteration
+void test_anderson_linear() {
+  const Index plain = linear_fixed_point_iterations(0);
+  std::cout << "Plain iteration: " << plain << " iterations\n";
+
+  for (Index depth : {1, 3, 5, 10}) {
+    const Index anderson = linear_fixed_point_iterations(depth);
+    std::cout << "Anderson mixing, depth " << depth << ": " << anderson
+              << " iterations\n";
+    ARTS_USER_ERROR_IF(anderson >= plain,
+                       "Anderson mixing of depth ", depth, " needs ",
+                       anderson, " iterations, plain iteration ", plain)
+  }
+}
+
+//! Mixing collinear residuals must not break the field
+void test_anderson_singular() {
+  const Verbosity verbosity;
+
+  Tensor6 x(2, 1, 1, 1, 1, 1, 1.0);
+  const ArrayOfTensor6 input(3, Tensor6(2, 1, 1, 1, 1, 1, 0.0));
+  const ArrayOfTensor6 output(3, x);
+
+  // All residuals are equal, so there are no changes to mix
+  const Index nused =
+      cloudbox_field_andersonAcceleration(x, input, output, verbosity);
+  ARTS_USER_ERROR_IF(nused not_eq 0, "Used ", nused, " singular changes")
+  ARTS_USER_ERROR_IF(x(0, 0, 0, 0, 0, 0) not_eq 1.0 or
+                         x(1, 0, 0, 0, 0, 0) not_eq 1.0,
+                     "The field changed although the mixing was skipped")
+}
+
+//! Equidistant DOIT grids and their step sizes
+struct Grids {
+  Vector za_grid;
+  Vector aa_grid;
+  Vector grid_stepsize;
+
+  Grids(Index nza, Index naa)
+      : za_grid(uniform_grid(0, nza, 180. / static_cast<Numeric>(nza - 1))),
+        aa_grid(naa == 1 ? Vector(1, 0.)
+                         : uniform_grid(0, naa, 360. / static_cast<Numeric>(naa - 1))),
+        grid_stepsize({za_grid[1] - za_grid[0],
+                       naa == 1 ? 0. : aa_grid[1] - aa_grid[0]}) {}
+};
+
+//! A smooth but not symmetric test function
+Numeric test_function(Index i, Index j, Index k) {
+  return 1.5 + std::sin(0.37 * static_cast<Numeric>(i + 1)) *
+                   std::cos(0.11 * static_cast<Numeric>(2 * j + k + 1));
+}
+
+Numeric weighted_sum(ConstMatrixView weights, ConstMatrixView integrand) {
+  Numeric sum = 0;
+  for (Index i = 0; i < weights.nrows(); i++)
+    for (Index j = 0; j < weights.ncols(); j++)
+      sum += weights(i, j) * integrand(i, j);
+  return sum;
+}
+
+//! The weights must reproduce the integration functions they replace
+void test_scat_field_weights() {
+  using Constant::pi;
+
+  for (Index nza : {3, 19, 37}) {
+    // A single azimuth angle, the integral over azimuth is 2 pi
+    {
+      const Grids grids(nza, 1);
+      const Matrix weights = doit_scat_field_weights(
+          grids.za_grid, grids.aa_grid, grids.grid_stepsize);
+
+      Matrix integrand(nza, 1);
+      for (Index i = 0; i < nza; i++) integrand(i, 0) = test_function(i, 0, 0);
+
+      const Numeric ref =
+          AngIntegrate_trapezoid(integrand(joker, 0), grids.za_grid);
+      const Numeric sum = weighted_sum(weights, integrand);
+      ARTS_USER_ERROR_IF(std::abs(2 * pi * sum - ref) > 1e-12 * std::abs(ref),
+                         "Single azimuth weights for ", nza, " angles: ",
+                         2 * pi * sum, " vs ", ref)
+    }
+
+    for (Index naa : {2, 10, 19}) {
+      const Grids grids(nza, naa);
+      const Matrix weights = doit_scat_field_weights(
+          grids.za_grid, grids.aa_grid, grids.grid_stepsize);
+
+      Matrix integrand(nza, naa);
+      for (Index i = 0; i < nza; i++)
+        for (Index j = 0; j < naa; j++) integrand(i, j) = test_function(i, j, 0);
+
+      const Numeric sum = weighted_sum(weights, integrand);
+      const Numeric ref_opti = AngIntegrate_trapezoid_opti(
+          integrand, grids.za_grid, grids.aa_grid, grids.grid_stepsize);
+      const Numeric ref =
+          AngIntegrate_trapezoid(integrand, grids.za_grid, grids.aa_grid);
+      ARTS_USER_ERROR_IF(
+          std::abs(sum - ref_opti) > 1e-12 * std::abs(ref_opti) or
+              std::abs(sum - ref) > 1e-12 * std::abs(ref),
+          "Weights for ", nza, "x", naa, " angles: ", sum, " vs ", ref_opti,
+          " (AngIntegrate_trapezoid_opti) and ", ref,
+          " (AngIntegrate_trapezoid)")
+    }
+  }
+}
+
+//! The matrix product must give the integral of the DOIT loops it replaces
+void test_scat_field1D() {
+  constexpr Index nza = 7, naa = 5, np = 3;
+
+  const Grids grids(nza, naa);
+  const Matrix weights = doit_scat_field_weights(
+      grids.za_grid, grids.aa_grid, grids.grid_stepsize);
+
+  Matrix pha_mat_level;
+  Vector field_weighted;
+  for (Index stokes_dim = 1; stokes_dim <= 4; stokes_dim++) {
+    Tensor7 pha_mat_doit(np, nza, 1, nza, naa, stokes_dim, stokes_dim);
+    for (Index p = 0; p < np; p++)
+      for (Index za_out = 0; za_out < nza; za_out++)
+        for (Index za_in = 0; za_in < nza; za_in++)
+          for (Index aa_in = 0; aa_in < naa; aa_in++)
+            for (Index i = 0; i < stokes_dim; i++)
+              for (Index j = 0; j < stokes_dim; j++)
+                pha_mat_doit(p, za_out, 0, za_in, aa_in, i, j) = test_function(
+                    p * nza + za_out, za_in * naa + aa_in, i * stokes_dim + j);
+
+    Matrix cloudbox_field(nza, stokes_dim);
+    for (Index za = 0; za < nza; za++)
+      for (Index j = 0; j < stokes_dim; j++)
+        cloudbox_field(za, j) = test_function(za, j, 3);
+
+    for (Index p = 0; p < np; p++) {
+      Matrix doit_scat_field(nza, stokes_dim);
+      doit_scat_field1D(doit_scat_field,
+                        pha_mat_level,
+                        field_weighted,
+                        pha_mat_doit,
+                        p,
+                        cloudbox_field,
+                        weights);
+
+      // The integration over the incoming directions as done per
+      // outgoing direction before
+      Matrix product_field(nza, naa);
+      for (Index za_out = 0; za_out < nza; za_out++) {
+        for (Index i = 0; i < stokes_dim; i++) {
+          for (Index za_in = 0; za_in < nza; za_in++) {
+            for (Index aa_in = 0; aa_in < naa; aa_in++) {
+              product_field(za_in, aa_in) = 0;
+              for (Index j = 0; j < stokes_dim; j++)
+                product_field(za_in, aa_in) +=
+                    pha_mat_doit(p, za_out, 0, za_in, aa_in, i, j) *
+                    cloudbox_field(za_in, j);
+            }
+          }
+
+          const Numeric ref = AngIntegrate_trapezoid_opti(
+              product_field, grids.za_grid, grids.aa_grid, grids.grid_stepsize);
+          ARTS_USER_ERROR_IF(
+              std::abs(doit_scat_field(za_out, i) - ref) > 1e-12 * std::abs(ref),
+              "Scattered field at level ", p, ", angle ", za_out,
+              ", Stokes component ", i, " of ", stokes_dim, ": ",
+              doit_scat_field(za_out, i), " vs ", ref)
+        }
+      }
+    }
+  }
+}
+
+int main() {
+  test_scat_field_weights();
+  test_scat_field1D();
+  test_anderson_linear();
+  test_anderson_singular();
+}
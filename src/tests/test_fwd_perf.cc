@@ -0,0 +1,172 @@
+#include "artstime.h"
+#include "debug.h"
+#include "fwd_lbl_algorithms.h"
+#include "fwd_lbl_mtckd_voigt.h"
+#include "fwd_radiance.h"
+#include "matpack_data.h"
+#include "matpack_math.h"
+#include "rng.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdlib>
+#include <iostream>
+#include <ostream>
+#include <vector>
+
+struct Timing {
+  std::string_view name;
+  Timing(const char * c) : name(c) {}
+  TimeStep dt{};
+  template <typename Function> void operator()(Function&& f) {
+    Time start{};
+    f();
+    Time end{};
+    dt = end - start;
+  }
+};
+
+std::ostream& operator<<(std::ostream& os, const std::vector<Timing>& vt) {
+  for (auto& t: vt) if (t.name not_eq "dummy") os << t.name  << " : " << t.dt << '\n';
+  return os;
+}
+
+//! Random but physically plausible lines between 1 and 1000 GHz
+std::vector<fwd::lbl::mtckd::single> random_lines(Index n) {
+  using fwd::lbl::mtckd::cutoff_freq;
+  using fwd::lbl::mtckd::single;
+
+  const Vector F0 = random_numbers(n, 1e9, 1e12);
+  const Vector G0 = random_numbers(n, 1e5, 1e8);
+  const Vector I0 = random_numbers(n, 1e-25, 1e-20);
+
+  std::vector<single> lines(n);
+  for (Index i = 0; i < n; i++) {
+    auto& l = lines[i];
+    l.F0 = F0[i];
+    l.invGD = 1.0 / (2e-6 * F0[i]);
+    l.z_imag = l.invGD * G0[i];
+    l.scl = -I0[i] * l.invGD;
+    l.cutoff = l.at<true>(l.F0 + cutoff_freq);
+  }
+
+  std::sort(lines.begin(), lines.end(), [](auto& a, auto& b) {
+    return a.F0 < b.F0;
+  });
+  return lines;
+}
+
+std::vector<Timing> test_mtckd_sumup(Index nlines, Index nfreq) {
+  using fwd::lbl::mtckd::cutoff_freq;
+
+  const auto lines = random_lines(nlines);
+  const Vector f_grid = uniform_grid(1e9, nfreq, 1e12 / static_cast<Numeric>(nfreq));
+  ComplexVector sum_aos(nfreq), sum_soa(nfreq);
+
+  std::vector<Timing> out;
+
+  fwd::lbl::mtckd::lines_soa soa;
+  out.emplace_back("lines_soa(lines)")([&]() {
+    soa = fwd::lbl::mtckd::lines_soa(lines);
+  });
+
+  out.emplace_back("sumup(lines, f, fc) for each f")([&]() {
+    std::transform(f_grid.begin(), f_grid.end(), sum_aos.begin(), [&](Numeric f) {
+      return fwd::lbl::sumup(lines, f, cutoff_freq);
+    });
+  });
+
+  out.emplace_back("lines_soa::sumup(sum, f_grid)")([&]() {
+    sum_soa = 0.0;
+    soa.sumup(sum_soa, f_grid);
+  });
+
+  // The difference relative to the size of the terms, as the sum cancels
+  // to zero where the lines are cut off
+  Numeric max_rel_diff = 0.0;
+  for (Index i = 0; i < nfreq; i++) {
+    const Numeric f = f_grid[i];
+    Numeric terms = 0.0;
+    for (auto& l : lines) {
+      if (std::abs(f - l.F0) <= cutoff_freq) terms += std::abs(l.at<true>(f)) + std::abs(l.cutoff);
+    }
+    max_rel_diff = std::max(max_rel_diff, std::abs(sum_aos[i] - sum_soa[i]) / terms);
+  }
+  std::cout << "max relative difference: " << max_rel_diff << '\n';
+
+  // Only the order of the additions differs
+  ARTS_USER_ERROR_IF(max_rel_diff > 1e-12,
+                     "lines_soa::sumup differs from sumup by ", max_rel_diff)
+
+  return out;
+}
+
+//! A 100-level atmosphere with the same random lines on all levels
+fwd::profile::spectral_radiance random_profile(Index nlines) {
+  constexpr Index nlevels = 100;
+
+  const fwd::lbl::mtckd::band band(300.0, 1e4, random_lines(nlines));
+
+  fwd::full_absorption model;
+  model.lbl.add(band);
+
+  fwd::profile::spectral_radiance profile;
+  profile.refl = 0.0;
+  profile.models.resize(nlevels, model);
+  for (Index i = 0; i < nlevels; i++) {
+    profile.altitude.push_back(1e3 * static_cast<Numeric>(i));
+    profile.temperature.push_back(300.0 - static_cast<Numeric>(i));
+  }
+  return profile;
+}
+
+std::vector<Timing> test_planar_par(Index nlines, Index nfreq) {
+  const auto profile = random_profile(nlines);
+  const Vector f_grid = uniform_grid(1e9, nfreq, 1e12 / static_cast<Numeric>(nfreq));
+  const Index nlevels = static_cast<Index>(profile.altitude.size());
+  Matrix rad_single(nfreq, nlevels), rad_block(nfreq, nlevels);
+
+  std::vector<Timing> out;
+
+  out.emplace_back("planar(rad, f, za) for each f")([&]() {
+#pragma omp parallel for
+    for (Index i = 0; i < nfreq; i++) profile.planar(rad_single[i], f_grid[i], 180.0);
+  });
+
+  out.emplace_back("planar_par(rad, f_grid, za)")([&]() {
+    profile.planar_par(ExhaustiveMatrixView{rad_block}, f_grid, 180.0);
+  });
+
+  Numeric max_rel_diff = 0.0;
+  for (Index i = 0; i < nfreq; i++) {
+    for (Index j = 0; j < nlevels; j++) {
+      max_rel_diff = std::max(max_rel_diff, std::abs(rad_single(i, j) - rad_block(i, j)) / std::abs(rad_single(i, j)));
+    }
+  }
+  std::cout << "max relative difference: " << max_rel_diff << '\n';
+
+  // The same absorption and radiative transfer per frequency
+  ARTS_USER_ERROR_IF(max_rel_diff > 1e-12,
+                     "planar_par differs from planar by ", max_rel_diff)
+
+  return out;
+}
+
+int main(int argc, char** c) try {
+  std::array <Index, 2> N;
+  if (static_cast<std::size_t>(argc) < 1 + 1 + N.size()) {
+    std::cerr << "Expects PROGNAME NREPEAT NLINES NFREQ\n";
+    return EXIT_FAILURE;
+  }
+
+  const auto n = static_cast<Index>(std::atoll(c[1]));
+  for (std::size_t i=0; i<N.size(); i++)  N[i] = static_cast<Index>(std::atoll(c[2 + i]));
+
+  for (Index i=0; i<n; i++) {
+    std::cout << N[0] << " lines " << N[1] << " frequencies test_mtckd_sumup\n" << test_mtckd_sumup(N[0], N[1]) << '\n';
+    std::cout << N[0] << " lines " << N[1] << " frequencies 100 levels test_planar_par\n" << test_planar_par(N[0], N[1]) << '\n';
+  }
+} catch (std::exception& e) {
+  std::cerr << e.what() << '\n';
+  return EXIT_FAILURE;
+}
@@ -0,0 +1,184 @@
+#include "absorptionlines.h"
+#include "arts_omp.h"
+#include "auto_md.h"
+#include "debug.h"
+#include "hitran_species.h"
+#include "jacobian.h"
+#include "matpack_data.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+
+//! A band of lines from F0 on, with line mixing and optionally a cutoff
+AbsorptionLines test_band(const char* isotopologue,
+                          Species::Species species,
+                          Numeric F0,
+                          bool cutoff) {
+  Array<AbsorptionSingleLine> lines;
+  for (Index i = 0; i < 8; i++) {
+    const Numeric x = 1.0 + 0.1 * static_cast<Numeric>(i);
+
+    LineShape::Model model(2);
+    for (Index j = 0; j < 2; j++) {
+      model[j].G0() = LineShape::ModelParameters(
+          LineShape::TemperatureModel::T1, x * 2e4, 0.75);
+      model[j].D0() = LineShape::ModelParameters(
+          LineShape::TemperatureModel::T5, x * 200, 0.8);
+      model[j].Y() = LineShape::ModelParameters(
+          LineShape::TemperatureModel::T1, x * 1e-6, 0.7);
+    }
+
+    lines.emplace_back(F0 + 7e9 * static_cast<Numeric>(i),
+                       x * 1e-20,
+                       x * 1e-21,
+                       1.,
+                       3.,
+                       1e-14,
+                       Zeeman::Model(),
+                       model);
+  }
+
+  return AbsorptionLines(true,
+                         true,
+                         cutoff ? Absorption::CutoffType::ByLine
+                                : Absorption::CutoffType::None,
+                         Absorption::MirroringType::None,
+                         Absorption::PopulationType::LTE,
+                         Absorption::NormalizationType::VVH,
+                         LineShape::Type::VP,
+                         296,
+                         cutoff ? 50e9 : -1,
+                         -1,
+                         QuantumIdentifier(isotopologue),
+                         {species, Species::Species::Bath},
+                         lines);
+}
+
+struct LblAbsorption {
+  PropagationMatrix propmat_clearsky;
+  StokesVector nlte_source;
+  ArrayOfPropagationMatrix dpropmat_clearsky_dx;
+  ArrayOfStokesVector dnlte_source_dx;
+};
+
+/** Line-by-line absorption and its derivatives with nthreads threads
+ *
+ * The grid of 1001 frequencies is computed serially with one thread, in
+ * three parts of 333 and 334 frequencies over two threads, and in parallel
+ * over the bands with eight threads, which have too few frequencies each.
+ */
+LblAbsorption lbl_absorption(Index nthreads) {
+  const Verbosity verbosity;
+  SetNumberOfThreads(nthreads, verbosity);
+
+  const Vector f_grid = uniform_grid(100e9, 1001, 0.1e9);
+  const ArrayOfArrayOfSpeciesTag abs_species{ArrayOfSpeciesTag("H2O-161"),
+                                             ArrayOfSpeciesTag("O2-66")};
+  const Vector rtp_vmr{0.01, 0.21};
+
+  ArrayOfArrayOfAbsorptionLines abs_lines_per_species(2);
+  for (Index i = 0; i < 3; i++) {
+    const Numeric F0 = 90e9 + 10e9 * static_cast<Numeric>(i);
+    abs_lines_per_species[0].push_back(
+        test_band("H2O-161", Species::Species::Water, F0, i == 1));
+    abs_lines_per_species[1].push_back(
+        test_band("O2-66", Species::Species::Oxygen, F0 + 3e9, i == 2));
+  }
+
+  ArrayOfRetrievalQuantity jacobian_quantities(3);
+  jacobian_quantities[0].Target(Jacobian::Target(Jacobian::Atm::Temperature));
+  jacobian_quantities[0].Target().perturbation = 0.1;
+  jacobian_quantities[1].Target(Jacobian::Target(Jacobian::Atm::WindU));
+  jacobian_quantities[1].Target().perturbation = 0.1;
+  jacobian_quantities[2].Target(Jacobian::Target(
+      Jacobian::Special::ArrayOfSpeciesTagVMR, abs_species[0]));
+  jacobian_quantities[2].Target().perturbation = 0.001;
+
+  LblAbsorption out;
+  propmat_clearskyInit(out.propmat_clearsky,
+                       out.nlte_source,
+                       out.dpropmat_clearsky_dx,
+                       out.dnlte_source_dx,
+                       jacobian_quantities,
+                       f_grid,
+                       1,
+                       1,
+                       verbosity);
+  propmat_clearskyAddLines(out.propmat_clearsky,
+                           out.nlte_source,
+                           out.dpropmat_clearsky_dx,
+                           out.dnlte_source_dx,
+                           f_grid,
+                           abs_species,
+                           {},
+                           jacobian_quantities,
+                           abs_lines_per_species,
+                           Hitran::isotopologue_ratios(),
+                           5e4,
+                           250,
+                           {},
+                           rtp_vmr,
+                           0,
+                           1,
+                           0,
+                           0,
+                           0,
+                           "None",
+                           1,
+                           verbosity);
+  return out;
+}
+
+/** Both absorptions must agree within tol of their largest value
+ *
+ * Each quantity is compared separately.
+ */
+void require_close(const LblAbsorption& test,
+                   const LblAbsorption& ref,
+                   Numeric tol,
+                   const char* what) {
+  const auto compare = [&](const PropagationMatrix& x,
+                           const PropagationMatrix& y,
+                           const char* quantity) {
+    const Numeric largest =
+        std::abs(*std::max_element(y.Data().elem_begin(),
+                                   y.Data().elem_end(),
+                                   [](auto a, auto b) {
+                                     return std::abs(a) < std::abs(b);
+                                   }));
+    ARTS_USER_ERROR_IF(largest == 0, what, ": no ", quantity)
+
+    for (Index i = 0; i < y.NumberOfFrequencies(); i++) {
+      ARTS_USER_ERROR_IF(std::abs(x.Kjj()[i] - y.Kjj()[i]) > tol * largest,
+                         what, ": ", quantity, " at frequency ", i, " is ",
+                         x.Kjj()[i], " vs ", y.Kjj()[i])
+    }
+  };
+
+  compare(test.propmat_clearsky, ref.propmat_clearsky, "absorption");
+  for (Index i = 0; i < ref.dpropmat_clearsky_dx.nelem(); i++) {
+    compare(test.dpropmat_clearsky_dx[i],
+            ref.dpropmat_clearsky_dx[i],
+            var_string("derivative ", i).c_str());
+  }
+}
+
+//! All parallel modes must give the serial result
+void test_lbl_parallel() {
+  const LblAbsorption serial = lbl_absorption(1);
+
+  // Each frequency is computed as in serial
+  require_close(lbl_absorption(2), serial, 0, "Parallel over frequency");
+
+  // The bands of each thread are summed before they are added up
+  require_close(lbl_absorption(8), serial, 1e-14, "Parallel over bands");
+}
+
+int main() try {
+  test_lbl_parallel();
+  return EXIT_SUCCESS;
+} catch (std::exception& e) {
+  std::cerr << e.what() << '\n';
+  return EXIT_FAILURE;
+}
@@ -152,7 +152,7 @@ void test_ls() {
   
   Vector f_grid(::N);
   ComplexVector F(::N), N(::N);
-  ComplexMatrix dF(::N, ::M, 0), dN(::N, ::M, 0);
+  ComplexMatrix dF(::M, ::N, 0), dN(::M, ::N, 0);
   ArrayOfComplexVector dF_mod(::M, ComplexVector(::N, 0)), dN_mod(::M, ComplexVector(::N, 0));
   ComplexMatrix dFnull(0, 0), dNnull(0, 0);
   ArrayOfRetrievalQuantity jacobian_quantities(::M);
@@ -480,11 +480,11 @@ void test_ls() {
   ARTSGUI::plot(f_grid, F.real(), f_grid, F.imag());
   for (Index i=0; i<::M; i++) {
     bool all_zero = true;
-    for (Index iv=0; iv<::N; iv++) all_zero = all_zero and dF(iv, i) == Complex(0, 0) and dF_mod[i][iv] == Complex(0, 0);
+    for (Index iv=0; iv<::N; iv++) all_zero = all_zero and dF(i, iv) == Complex(0, 0) and dF_mod[i][iv] == Complex(0, 0);
     if (all_zero) continue;  // plot only if some are non-zero
     
     std::cout << jacobian_quantities[i].Target() << '\n';
-    ARTSGUI::plot(f_grid, dF(joker, i).real(), f_grid, dF(joker, i).imag(), f_grid, dF_mod[i].real(), f_grid, dF_mod[i].imag());
+    ARTSGUI::plot(f_grid, dF(i, joker).real(), f_grid, dF(i, joker).imag(), f_grid, dF_mod[i].real(), f_grid, dF_mod[i].imag());
   }
   std::cout << '\n';
 }
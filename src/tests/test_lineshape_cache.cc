@@ -0,0 +1,223 @@
+#include "absorptionlines.h"
+#include "debug.h"
+#include "jacobian.h"
+#include "lineshape.h"
+#include "matpack_data.h"
+#include "species.h"
+
+#include <cstdlib>
+#include <iostream>
+
+//! A band of water lines with line mixing and self and air broadening
+AbsorptionLines water_band() {
+  const QuantumIdentifier qid("H2O-161");
+
+  Array<AbsorptionSingleLine> lines;
+  for (Index i = 0; i < 10; i++) {
+    LineShape::Model model(2);
+    for (Index j = 0; j < 2; j++) {
+      const Numeric x = 1.0 + 0.2 * static_cast<Numeric>(j);
+      model[j].G0() = LineShape::ModelParameters(
+          LineShape::TemperatureModel::T1, x * 2e4, 0.75);
+      model[j].D0() = LineShape::ModelParameters(
+          LineShape::TemperatureModel::T5, x * 200, 0.8);
+      model[j].Y() = LineShape::ModelParameters(
+          LineShape::TemperatureModel::T1, x * 1e-6, 0.7);
+    }
+
+    lines.emplace_back(100e9 + 15e9 * static_cast<Numeric>(i),
+                       1e-20 * static_cast<Numeric>(i + 1),
+                       1e-21 * static_cast<Numeric>(i),
+                       1.,
+                       3.,
+                       1e-14,
+                       Zeeman::Model(),
+                       model);
+  }
+
+  return AbsorptionLines(true,
+                         true,
+                         Absorption::CutoffType::None,
+                         Absorption::MirroringType::None,
+                         Absorption::PopulationType::LTE,
+                         Absorption::NormalizationType::VVH,
+                         LineShape::Type::VP,
+                         296,
+                         -1,
+                         -1,
+                         qid,
+                         {Species::Species::Water, Species::Species::Bath},
+                         lines);
+}
+
+struct State {
+  Vector f_grid{uniform_grid(90e9, 1001, 0.17e9)};
+  Vector vmrs{0.01, 0.99};
+  Numeric P{5e4};
+  Numeric T{250};
+  ArrayOfRetrievalQuantity jacobian_quantities;
+
+  State() {
+    jacobian_quantities.resize(2);
+    jacobian_quantities[0].Target(
+        Jacobian::Target(Jacobian::Atm::Temperature));
+    jacobian_quantities[0].Target().perturbation = 0.1;
+    jacobian_quantities[1].Target(Jacobian::Target(Jacobian::Atm::WindU));
+    jacobian_quantities[1].Target().perturbation = 0.1;
+  }
+};
+
+//! Adds the absorption and its derivatives of the band to com
+void compute(LineShape::ComputeData& com,
+             const AbsorptionLines& band,
+             const State& state,
+             Index cache_size) {
+  const Vector no_sparse_f_grid(0);
+  LineShape::ComputeData sparse_com(
+      no_sparse_f_grid, state.jacobian_quantities, false);
+  LineShape::compute(com,
+                     sparse_com,
+                     band,
+                     state.jacobian_quantities,
+                     {},
+                     state.vmrs,
+                     {},
+                     state.vmrs[0],
+                     1.0,
+                     state.P,
+                     state.T,
+                     0,
+                     0,
+                     Zeeman::Polarization::None,
+                     Options::LblSpeedup::None,
+                     false,
+                     cache_size);
+}
+
+//! The absorption and its derivatives of the band
+LineShape::ComputeData compute(const AbsorptionLines& band,
+                               const State& state,
+                               Index cache_size) {
+  LineShape::ComputeData com(state.f_grid, state.jacobian_quantities, false);
+  compute(com, band, state, cache_size);
+  return com;
+}
+
+/** Both calculations must give the same absorption and derivatives
+ *
+ * The frequencies of cached start at offset in the frequencies of uncached.
+ */
+void require_equal(const LineShape::ComputeData& cached,
+                   const LineShape::ComputeData& uncached,
+                   const char* what,
+                   Index offset = 0) {
+  ARTS_USER_ERROR_IF(cached.F.nelem() + offset > uncached.F.nelem() or
+                         cached.dF.nrows() not_eq uncached.dF.nrows(),
+                     what, ": different sizes")
+
+  for (Index i = 0; i < cached.F.nelem(); i++) {
+    ARTS_USER_ERROR_IF(cached.F[i] not_eq uncached.F[i + offset],
+                       what, ": absorption at ", i + offset, " is ",
+                       cached.F[i], " cached and ", uncached.F[i + offset],
+                       " uncached")
+    for (Index j = 0; j < cached.dF.nrows(); j++) {
+      ARTS_USER_ERROR_IF(cached.dF(j, i) not_eq uncached.dF(j, i + offset),
+                         what, ": derivative ", j, " at ", i + offset, " is ",
+                         cached.dF(j, i), " cached and ",
+                         uncached.dF(j, i + offset), " uncached")
+    }
+  }
+}
+
+//! Cached line parameters must give the same result as computed ones
+void test_cached_equals_uncached() {
+  const AbsorptionLines band = water_band();
+  State state;
+
+  const auto uncached = compute(band, state, 0);
+  require_equal(compute(band, state, 2), uncached, "First call");
+  require_equal(compute(band, state, 2), uncached, "Cache hit");
+
+  // Other states and back, more states than the cache keeps
+  for (Numeric T : {260.0, 270.0, 250.0}) {
+    state.T = T;
+    require_equal(compute(band, state, 2),
+                  compute(band, state, 0),
+                  "Changed temperature");
+  }
+}
+
+//! Changing the band in place must not return the line parameters of before
+void test_band_edit() {
+  AbsorptionLines band = water_band();
+  const State state;
+
+  const auto before = compute(band, state, 2);
+
+  // As abs_linesLinemixingLimit, line mixing off at this pressure
+  band.linemixinglimit = state.P / 2;
+  const auto no_linemixing = compute(band, state, 2);
+  require_equal(
+      no_linemixing, compute(band, state, 0), "Line mixing limit");
+  ARTS_USER_ERROR_IF(no_linemixing.F[500] == before.F[500],
+                     "Line mixing limit has no effect")
+
+  // A single broadening parameter of a single line
+  band.lines[3].lineshape[1].G0().X0 *= 1.5;
+  require_equal(compute(band, state, 2),
+                compute(band, state, 0),
+                "Broadening of one line");
+
+  // Back to the first band
+  band = water_band();
+  require_equal(compute(band, state, 2), before, "Original band");
+}
+
+//! Frequency ranges computed in parallel share the cache of the band
+void test_frequency_parallel() {
+  constexpr Index nparts = 7;
+
+  const AbsorptionLines band = water_band();
+  State state;
+
+  for (Numeric T : {250.0, 260.0, 250.0}) {
+    state.T = T;
+    const auto serial = compute(band, state, 0);
+
+    // The parts do not divide the grid evenly
+    const Index nf = state.f_grid.nelem();
+    ArrayOfVector f_grids(nparts);
+    for (Index i = 0; i < nparts; i++) {
+      const Index first = i * nf / nparts;
+      f_grids[i] = state.f_grid[Range(first, (i + 1) * nf / nparts - first)];
+    }
+
+    std::vector<LineShape::ComputeData> parts;
+    parts.reserve(nparts);
+    for (Index i = 0; i < nparts; i++)
+      parts.emplace_back(f_grids[i], state.jacobian_quantities, false);
+
+#pragma omp parallel for schedule(dynamic, 1)
+    for (Index i = 0; i < nparts; i++) {
+      compute(parts[i], band, state, 2);
+    }
+
+    Index first = 0;
+    for (auto& part : parts) {
+      require_equal(part, serial, "Frequency parallel", first);
+      first += part.F.nelem();
+    }
+    ARTS_USER_ERROR_IF(first not_eq nf, "Parts cover ", first, " of ", nf,
+                       " frequencies")
+  }
+}
+
+int main() try {
+  test_cached_equals_uncached();
+  test_band_edit();
+  test_frequency_parallel();
+  return EXIT_SUCCESS;
+} catch (std::exception& e) {
+  std::cerr << e.what() << '\n';
+  return EXIT_FAILURE;
+}
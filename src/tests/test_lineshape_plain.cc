@@ -0,0 +1,154 @@
+#include "absorptionlines.h"
+#include "debug.h"
+#include "jacobian.h"
+#include "lineshape.h"
+#include "matpack_data.h"
+#include "species.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+
+//! A band of water lines with line mixing and speed-dependent broadening
+AbsorptionLines water_band(LineShape::Type type,
+                           Absorption::MirroringType mirroring,
+                           Absorption::NormalizationType normalization,
+                           bool cutoff) {
+  Array<AbsorptionSingleLine> lines;
+  for (Index i = 0; i < 10; i++) {
+    LineShape::Model model(2);
+    for (Index j = 0; j < 2; j++) {
+      const Numeric x = 1.0 + 0.2 * static_cast<Numeric>(j);
+      model[j].G0() = LineShape::ModelParameters(
+          LineShape::TemperatureModel::T1, x * 2e4, 0.75);
+      model[j].D0() = LineShape::ModelParameters(
+          LineShape::TemperatureModel::T5, x * 200, 0.8);
+      model[j].G2() = LineShape::ModelParameters(
+          LineShape::TemperatureModel::T1, x * 2e3, 0.75);
+      model[j].D2() = LineShape::ModelParameters(
+          LineShape::TemperatureModel::T1, x * 20, 0.8);
+      model[j].Y() = LineShape::ModelParameters(
+          LineShape::TemperatureModel::T1, x * 1e-6, 0.7);
+    }
+
+    lines.emplace_back(100e9 + 15e9 * static_cast<Numeric>(i),
+                       1e-20 * static_cast<Numeric>(i + 1),
+                       1e-21 * static_cast<Numeric>(i),
+                       1.,
+                       3.,
+                       1e-14,
+                       Zeeman::Model(),
+                       model);
+  }
+
+  return AbsorptionLines(true,
+                         true,
+                         cutoff ? Absorption::CutoffType::ByLine
+                                : Absorption::CutoffType::None,
+                         mirroring,
+                         Absorption::PopulationType::LTE,
+                         normalization,
+                         type,
+                         296,
+                         cutoff ? 50e9 : -1,
+                         -1,
+                         QuantumIdentifier("H2O-161"),
+                         {Species::Species::Water, Species::Species::Bath},
+                         lines);
+}
+
+/** The absorption of the band
+ *
+ * Without derivatives the line shape types are resolved once per line,
+ * with derivatives the generic frequency loops are used.
+ */
+LineShape::ComputeData compute(const AbsorptionLines& band,
+                               bool with_derivatives) {
+  const Vector f_grid = uniform_grid(1e9, 1001, 0.25e9);
+  const Vector vmrs{0.01, 0.99};
+
+  ArrayOfRetrievalQuantity jacobian_quantities;
+  if (with_derivatives) {
+    jacobian_quantities.resize(1);
+    jacobian_quantities[0].Target(
+        Jacobian::Target(Jacobian::Atm::Temperature));
+    jacobian_quantities[0].Target().perturbation = 0.1;
+  }
+
+  LineShape::ComputeData com(f_grid, jacobian_quantities, false);
+  const Vector no_sparse_f_grid(0);
+  LineShape::ComputeData sparse_com(
+      no_sparse_f_grid, jacobian_quantities, false);
+  LineShape::compute(com,
+                     sparse_com,
+                     band,
+                     jacobian_quantities,
+                     {},
+                     vmrs,
+                     {},
+                     vmrs[0],
+                     1.0,
+                     5e4,
+                     250,
+                     0,
+                     0,
+                     Zeeman::Polarization::None,
+                     Options::LblSpeedup::None,
+                     false,
+                     0);
+  return com;
+}
+
+/** Both loops must give the same absorption
+ *
+ * They multiply the same factors in another order, so they agree within
+ * rounding relative to the largest absorption.
+ */
+void require_close(const LineShape::ComputeData& plain,
+                   const LineShape::ComputeData& generic,
+                   const String& what) {
+  const Numeric largest =
+      std::abs(*std::max_element(generic.F.begin(),
+                                 generic.F.end(),
+                                 [](auto a, auto b) {
+                                   return std::abs(a) < std::abs(b);
+                                 }));
+  ARTS_USER_ERROR_IF(largest == 0, what, ": no absorption")
+
+  for (Index i = 0; i < generic.F.nelem(); i++) {
+    ARTS_USER_ERROR_IF(std::abs(plain.F[i] - generic.F[i]) > 1e-14 * largest,
+                       what, ": absorption at ", i, " is ", plain.F[i],
+                       " without and ", generic.F[i], " with derivatives")
+  }
+}
+
+//! The specialized frequency loops must give the result of the generic ones
+void test_plain_equals_generic() {
+  for (auto type : {LineShape::Type::VP, LineShape::Type::SDVP}) {
+    for (auto mirroring : {Absorption::MirroringType::None,
+                           Absorption::MirroringType::Lorentz,
+                           Absorption::MirroringType::SameAsLineShape}) {
+      for (auto normalization : {Absorption::NormalizationType::None,
+                                 Absorption::NormalizationType::VVH}) {
+        for (bool cutoff : {false, true}) {
+          const AbsorptionLines band =
+              water_band(type, mirroring, normalization, cutoff);
+          require_close(compute(band, false),
+                        compute(band, true),
+                        var_string(type, " lines, ", mirroring,
+                                   " mirroring, ", normalization,
+                                   " normalization, ",
+                                   cutoff ? "with" : "without", " cutoff"));
+        }
+      }
+    }
+  }
+}
+
+int main() try {
+  test_plain_equals_generic();
+  return EXIT_SUCCESS;
+} catch (std::exception& e) {
+  std::cerr << e.what() << '\n';
+  return EXIT_FAILURE;
+}
@@ -1,7 +1,95 @@
+#include "debug.h"
 #include "rng.h"
+
+#include <array>
+#include <cstdint>
 #include <random>
+#include <unordered_set>
+
+using Block = std::array<std::uint32_t, 4>;
+using Key = std::array<std::uint32_t, 2>;
+
+//! The Philox4x32-10 known-answer vectors of Random123 (kat_vectors)
+void test_philox_kat() {
+  constexpr std::array<std::pair<Block, Key>, 3> in{
+      std::pair<Block, Key>{{0x00000000, 0x00000000, 0x00000000, 0x00000000},
+                            {0x00000000, 0x00000000}},
+      std::pair<Block, Key>{{0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+                            {0xffffffff, 0xffffffff}},
+      std::pair<Block, Key>{{0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344},
+                            {0xa4093822, 0x299f31d0}}};
+  constexpr std::array<Block, 3> out{
+      Block{0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8},
+      Block{0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd},
+      Block{0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1}};
+
+  static_assert(Philox4x32::generate(in[0].first, in[0].second) == out[0]);
+
+  for (std::size_t i = 0; i < in.size(); i++) {
+    ARTS_USER_ERROR_IF(Philox4x32::generate(in[i].first, in[i].second) not_eq out[i],
+                       "Philox4x32 known-answer test ", i, " fails")
+  }
+
+  // The first block of the default stream is that of a zero counter and key
+  Philox4x32 gen{};
+  for (auto x : out[0]) ARTS_USER_ERROR_IF(gen() not_eq x, "Wrong first block")
+}
+
+//! Sets of consecutive pairs of outputs, unlikely to repeat by chance
+std::unordered_set<std::uint64_t> pairs(Philox4x32 gen, std::size_t n) {
+  std::unordered_set<std::uint64_t> out;
+  for (std::size_t i = 0; i < n; i++) {
+    const std::uint64_t a = gen();
+    out.insert(a << 32 | gen());
+  }
+  return out;
+}
+
+//! Streams that differ in the key or in the stream index do not overlap
+void test_philox_streams() {
+  constexpr std::size_t n = 1 << 16;
+  const auto ref = pairs(Philox4x32{1, 0}, n);
+  ARTS_USER_ERROR_IF(ref.size() not_eq n, "The stream repeats itself")
+
+  for (auto gen : {Philox4x32{1, 1}, Philox4x32{2, 0}, Philox4x32{1, 1ULL << 32}}) {
+    for (auto x : pairs(gen, n)) {
+      ARTS_USER_ERROR_IF(ref.contains(x), "Streams overlap")
+    }
+  }
+}
+
+//! Discarding is the same as drawing
+void test_philox_discard() {
+  for (unsigned long long n : {0, 1, 3, 4, 5, 11, 1000}) {
+    Philox4x32 a{7, 3}, b{7, 3};
+    for (unsigned long long i = 0; i < n; i++) a();
+    b.discard(n);
+    for (int i = 0; i < 9; i++)
+      ARTS_USER_ERROR_IF(a() not_eq b(), "discard(", n, ") is not drawing")
+  }
+}
+
+//! Separate RandomNumberStream objects of the same stream give the same numbers
+void test_random_number_stream() {
+  RandomNumberStream a(42, 5), b(42, 5), c(42, 6);
+  auto ra = a.get(0.0, 1.0);
+  auto rb = b.get(0.0, 1.0);
+  auto rc = c.get(0.0, 1.0);
+  bool all_same = true;
+  for (int i = 0; i < 100; i++) {
+    const Numeric x = ra();
+    ARTS_USER_ERROR_IF(x not_eq rb(), "Same stream gives different numbers")
+    all_same = all_same and x == rc();
+  }
+  ARTS_USER_ERROR_IF(all_same, "Different streams give the same numbers")
+}
 
 int main() {
+  test_philox_kat();
+  test_philox_streams();
+  test_philox_discard();
+  test_random_number_stream();
+
   auto x = random_numbers<std::uniform_int_distribution>(10, 0, 20);
   std::cout << x << '\n';
   auto y = random_numbers<2>({2, 3}, 0.0, 1.0);
@@ -0,0 +1,97 @@
+#include "artstime.h"
+#include "debug.h"
+#include "matpack_data.h"
+#include "propagationmatrix.h"
+#include "rng.h"
+#include "transmissionmatrix.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <ostream>
+#include <vector>
+
+struct Timing {
+  std::string_view name;
+  Timing(const char * c) : name(c) {}
+  TimeStep dt{};
+  template <typename Function> void operator()(Function&& f) {
+    Time start{};
+    f();
+    Time end{};
+    dt = end - start;
+  }
+};
+
+std::ostream& operator<<(std::ostream& os, const std::vector<Timing>& vt) {
+  for (auto& t: vt) if (t.name not_eq "dummy") os << t.name  << " : " << t.dt << '\n';
+  return os;
+}
+
+//! Random polarized propagation matrix, every tenth frequency unpolarized
+PropagationMatrix random_propmat(Index nfreq) {
+  PropagationMatrix K(nfreq, 4);
+  const Vector kjj = random_numbers(nfreq, 1e-3, 1e-2);
+  const Matrix kij = random_numbers<2>({nfreq, 6}, -1e-3, 1e-3);
+  for (Index i = 0; i < nfreq; i++) {
+    K.Data()(0, 0, i, 0) = kjj[i];
+    for (Index j = 0; j < 6; j++) K.Data()(0, 0, i, j + 1) = i % 10 ? kij(i, j) : 0.0;
+  }
+  return K;
+}
+
+std::vector<Timing> test_stokes4_transmission(Index nfreq) {
+  constexpr Numeric r = 100.0;
+  const PropagationMatrix K1 = random_propmat(nfreq);
+  const PropagationMatrix K2 = random_propmat(nfreq);
+  Tensor3 T_single(nfreq, 4, 4);
+  TransmissionMatrix T_batch(nfreq, 4);
+  ArrayOfTransmissionMatrix dT1, dT2;
+
+  std::vector<Timing> out;
+
+  out.emplace_back("compute_transmission_matrix(T, r, K1, K2)")([&]() {
+    compute_transmission_matrix(T_single, r, K1, K2);
+  });
+
+  out.emplace_back("stepwise_transmission(T, dT1, dT2, K1, K2, {}, {}, r, 0, 0, -1)")([&]() {
+    stepwise_transmission(T_batch, dT1, dT2, K1, K2, {}, {}, r, 0, 0, -1);
+  });
+
+  Numeric max_rel_diff = 0.0;
+  for (Index i = 0; i < nfreq; i++) {
+    const Numeric scl = T_single(i, 0, 0);
+    for (Index j = 0; j < 4; j++) {
+      for (Index k = 0; k < 4; k++) {
+        max_rel_diff = std::max(max_rel_diff, std::abs(T_single(i, j, k) - T_batch(i, j, k)) / scl);
+      }
+    }
+  }
+  std::cout << "max relative difference: " << max_rel_diff << '\n';
+
+  // Relative to the transmission of the first Stokes component.  Both
+  // closed forms lose precision in differences as cosh(x) - cos(y) for small
+  // eigenvalues, which gives up to about 2e-10 for these matrices
+  ARTS_USER_ERROR_IF(max_rel_diff > 1e-9,
+                     "stepwise_transmission differs from "
+                     "compute_transmission_matrix by ", max_rel_diff)
+
+  return out;
+}
+
+int main(int argc, char** c) try {
+  if (argc < 3) {
+    std::cerr << "Expects PROGNAME NREPEAT NFREQ\n";
+    return EXIT_FAILURE;
+  }
+
+  const auto n = static_cast<Index>(std::atoll(c[1]));
+  const auto nfreq = static_cast<Index>(std::atoll(c[2]));
+
+  for (Index i=0; i<n; i++) {
+    std::cout << nfreq << " frequencies test_stokes4_transmission\n" << test_stokes4_transmission(nfreq) << '\n';
+  }
+} catch (std::exception& e) {
+  std::cerr << e.what() << '\n';
+  return EXIT_FAILURE;
+}
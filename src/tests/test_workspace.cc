@@ -0,0 +1,85 @@
+#include "agenda_record.h"
+#include "debug.h"
+#include "global_data.h"
+#include "methods.h"
+#include "tokval.h"
+#include "workspace.h"
+#include "workspace_ng.h"
+
+#include <memory>
+
+void init_global_data() {
+  define_wsv_groups();
+  define_wsv_data();
+  define_wsv_map();
+  define_md_data_raw();
+  expand_md_data_raw_to_md_data();
+  define_md_map();
+  define_md_raw_map();
+  define_agenda_data();
+  define_agenda_map();
+  global_data::workspace_memory_handler.initialize();
+}
+
+Index add_index(Workspace& ws, const char* name, Index value) {
+  const Index pos = ws.add_wsv(WsvRecord(
+      name, "Test variable", WorkspaceGroupIndexValue<Index>));
+  ws.push_move(pos, std::make_shared<Index>(value));
+  return pos;
+}
+
+Index value(Workspace& ws, Index pos) {
+  return *static_cast<Index*>(ws[pos].get());
+}
+
+//! A WSV added through a shallow copy is shared by name but not by value
+void test_shallowcopy_add_wsv() {
+  auto ws = Workspace::create();
+  auto copy = ws->shallowcopy();
+
+  const Index pos = add_index(*copy, "test_shallowcopy_var", 3);
+  ARTS_USER_ERROR_IF(value(*copy, pos) not_eq 3, "Wrong value in the copy")
+
+  ARTS_USER_ERROR_IF(ws->is_initialized(pos), "Initialized in the original")
+  ARTS_USER_ERROR_IF(ws->depth(pos) not_eq 0, "Stack in the original")
+  ARTS_USER_ERROR_IF(ws->get<Index>("test_shallowcopy_var"), "Value in the original")
+
+  ws->push_move(pos, std::make_shared<Index>(4));
+  ARTS_USER_ERROR_IF(value(*ws, pos) not_eq 4, "Wrong value in the original")
+  ARTS_USER_ERROR_IF(value(*copy, pos) not_eq 3, "Copy changed by the original")
+
+  const auto deep = copy->deepcopy();
+  ARTS_USER_ERROR_IF(value(*deep, pos) not_eq 3, "Wrong value in the deep copy")
+}
+
+//! WSVs added through a fork or its parent after forking
+void test_fork_add_wsv() {
+  auto ws = Workspace::create();
+  auto fork = ws->fork();
+
+  const Index pos = add_index(*fork, "test_fork_var", 5);
+  ARTS_USER_ERROR_IF(value(*fork, pos) not_eq 5, "Wrong value in the fork")
+
+  ARTS_USER_ERROR_IF(ws->is_initialized(pos), "Initialized in the parent")
+  ARTS_USER_ERROR_IF(ws->depth(pos) not_eq 0, "Stack in the parent")
+
+  const Index parent_pos = add_index(*ws, "test_fork_parent_var", 6);
+  ARTS_USER_ERROR_IF(value(*ws, parent_pos) not_eq 6, "Wrong value in the parent")
+
+  auto fresh_fork = ws->fork();
+  ARTS_USER_ERROR_IF(fresh_fork->depth(parent_pos) not_eq 1, "Not read from the parent")
+  ARTS_USER_ERROR_IF(value(*fresh_fork, parent_pos) not_eq 6, "Wrong value read from the parent")
+  ARTS_USER_ERROR_IF(fresh_fork->is_initialized(pos), "Initialized in the new fork")
+
+  // The first fork has not changed the parent's new WSV, so reads it
+  auto nested_fork = fork->fork();
+  ARTS_USER_ERROR_IF(value(*nested_fork, pos) not_eq 5, "Wrong value in the nested fork")
+  ARTS_USER_ERROR_IF(nested_fork->depth(parent_pos) not_eq 1, "Not read through the fork")
+  ARTS_USER_ERROR_IF(value(*fork, parent_pos) not_eq 6, "Wrong value read by the fork")
+}
+
+int main() {
+  init_global_data();
+  test_shallowcopy_add_wsv();
+  test_fork_add_wsv();
+}
@@ -756,73 +756,88 @@ inline void transmat4(TransmissionMatrix& T,
                       const Index iz = 0,
                       const Index ia = 0) noexcept {
   static constexpr Numeric sqrt_05 = Constant::inv_sqrt_2;
-  for (Index i = 0; i < K1.NumberOfFrequencies(); i++) {
-    const Numeric a = -0.5 * r * (K1.Kjj(iz, ia)[i] + K2.Kjj(iz, ia)[i]),
-                  b = -0.5 * r * (K1.K12(iz, ia)[i] + K2.K12(iz, ia)[i]),
-                  c = -0.5 * r * (K1.K13(iz, ia)[i] + K2.K13(iz, ia)[i]),
-                  d = -0.5 * r * (K1.K14(iz, ia)[i] + K2.K14(iz, ia)[i]),
-                  u = -0.5 * r * (K1.K23(iz, ia)[i] + K2.K23(iz, ia)[i]),
-                  v = -0.5 * r * (K1.K24(iz, ia)[i] + K2.K24(iz, ia)[i]),
-                  w = -0.5 * r * (K1.K34(iz, ia)[i] + K2.K34(iz, ia)[i]);
-    const Numeric exp_a = std::exp(a);
 
-    if (b == 0. and c == 0. and d == 0. and u == 0. and v == 0. and w == 0.)
-      T.Mat4(i).noalias() = Eigen::Matrix4d::Identity() * exp_a;
-    else {
-      const Numeric b2 = b * b, c2 = c * c, d2 = d * d, u2 = u * u, v2 = v * v,
-                    w2 = w * w;
+  /* The frequencies are processed in blocks.  The seven independent elements
+   * are gathered into frequency-contiguous arrays so that the coefficients of
+   * the closed-form exponential can be computed for the whole block in real
+   * arithmetic without branches, which the compiler can vectorize.  The
+   * eigenvalues of the non-diagonal part are ±x and ±iy, see also
+   * compute_transmission_matrix
+   */
+  static constexpr Index nb = 64;
+  std::array<Numeric, nb> ka, kb, kc, kd, ku, kv, kw, C0s, C1s, C2s, C3s;
+
+  const ConstMatrixView K1d = K1.Data()(ia, iz, joker, joker);
+  const ConstMatrixView K2d = K2.Data()(ia, iz, joker, joker);
+  const Index nf = K1.NumberOfFrequencies();
+
+  for (Index i0 = 0; i0 < nf; i0 += nb) {
+    const Index n = std::min(nb, nf - i0);
+
+    for (Index j = 0; j < n; j++) {
+      ka[j] = -0.5 * r * (K1d(i0 + j, 0) + K2d(i0 + j, 0));
+      kb[j] = -0.5 * r * (K1d(i0 + j, 1) + K2d(i0 + j, 1));
+      kc[j] = -0.5 * r * (K1d(i0 + j, 2) + K2d(i0 + j, 2));
+      kd[j] = -0.5 * r * (K1d(i0 + j, 3) + K2d(i0 + j, 3));
+      ku[j] = -0.5 * r * (K1d(i0 + j, 4) + K2d(i0 + j, 4));
+      kv[j] = -0.5 * r * (K1d(i0 + j, 5) + K2d(i0 + j, 5));
+      kw[j] = -0.5 * r * (K1d(i0 + j, 6) + K2d(i0 + j, 6));
+    }
+
+#pragma omp simd
+    for (Index j = 0; j < n; j++) {
+      const Numeric b2 = kb[j] * kb[j], c2 = kc[j] * kc[j], d2 = kd[j] * kd[j],
+                    u2 = ku[j] * ku[j], v2 = kv[j] * kv[j], w2 = kw[j] * kw[j];
 
       const Numeric tmp =
-          w2 * w2 + 2 * (b2 * (b2 * 0.5 + c2 + d2 - u2 - v2 + w2) +
-                         c2 * (c2 * 0.5 + d2 - u2 + v2 - w2) +
-                         d2 * (d2 * 0.5 + u2 - v2 - w2) +
-                         u2 * (u2 * 0.5 + v2 + w2) + v2 * (v2 * 0.5 + w2) +
-                         4 * (b * d * u * w - b * c * v * w - c * d * u * v));
-      const Complex Const1 = std::sqrt(Complex(tmp, 0));
+          w2 * w2 +
+          2 * (b2 * (b2 * 0.5 + c2 + d2 - u2 - v2 + w2) +
+               c2 * (c2 * 0.5 + d2 - u2 + v2 - w2) +
+               d2 * (d2 * 0.5 + u2 - v2 - w2) + u2 * (u2 * 0.5 + v2 + w2) +
+               v2 * (v2 * 0.5 + w2) +
+               4 * (kb[j] * kd[j] * ku[j] * kw[j] -
+                    kb[j] * kc[j] * kv[j] * kw[j] -
+                    kc[j] * kd[j] * ku[j] * kv[j]));
+      const Numeric Const1 = std::sqrt(std::max(tmp, 0.0));
       const Numeric Const2 = b2 + c2 + d2 - u2 - v2 - w2;
 
-      const Complex x = std::sqrt(Const2 + Const1) * sqrt_05;
-      const Complex y = std::sqrt(Const2 - Const1) * sqrt_05 * Complex(0, 1);
-      const Complex x2 = x * x;
-      const Complex y2 = y * y;
-      const Complex cy = std::cos(y);
-      const Complex sy = std::sin(y);
-      const Complex cx = std::cosh(x);
-      const Complex sx = std::sinh(x);
+      const Numeric x = std::sqrt(std::max(Const2 + Const1, 0.0)) * sqrt_05;
+      const Numeric y = std::sqrt(std::max(Const1 - Const2, 0.0)) * sqrt_05;
+      const Numeric x2 = x * x;
+      const Numeric y2 = y * y;
+      const Numeric cx = std::cosh(x);
+      const Numeric cy = std::cos(y);
 
-      const bool x_zero = std::abs(x) < lower_is_considered_zero_for_sinc_likes;
-      const bool y_zero = std::abs(y) < lower_is_considered_zero_for_sinc_likes;
+      const bool x_zero = x < lower_is_considered_zero_for_sinc_likes;
+      const bool y_zero = y < lower_is_considered_zero_for_sinc_likes;
       const bool both_zero = y_zero and x_zero;
       const bool either_zero = y_zero or x_zero;
 
       /* Using:
-         *    lim x→0 [({cosh(x),cos(x)} - 1) / x^2] → 1/2
-         *    lim x→0 [{sinh(x),sin(x)} / x]  → 1
-         *    inv_x2 := 1 for x == 0,
-         *    -i sin(ix) → sinh(x)
-         *    cos(ix) → cosh(x)
-         *    C0, C1, C2 ∝ [1/x^2]
-         */
-      const Complex ix = x_zero ? 0.0 : 1.0 / x;
-      const Complex iy = y_zero ? 0.0 : 1.0 / y;
-      const Complex inv_x2y2 =
-          both_zero
-              ? 1.0
-              : 1.0 /
-                    (x2 + y2);  // The first "1.0" is the trick for above limits
+       *    lim x→0 [({cosh(x),cos(x)} - 1) / x^2] → 1/2
+       *    lim x→0 [{sinh(x),sin(x)} / x]  → 1
+       *    inv_x2y2 := 1 for x == 0 and y == 0,
+       *    C0, C1, C2, C3 ∝ [1/(x^2 + y^2)]
+       */
+      const Numeric sx_x = x_zero ? 1.0 : std::sinh(x) / x;
+      const Numeric sy_y = y_zero ? 1.0 : std::sin(y) / y;
+      const Numeric inv_x2y2 = both_zero ? 1.0 : 1.0 / (x2 + y2);
+
+      C0s[j] = either_zero ? 1.0 : (cy * x2 + cx * y2) * inv_x2y2;
+      C1s[j] = either_zero ? 1.0 : (sy_y * x2 + sx_x * y2) * inv_x2y2;
+      C2s[j] = both_zero ? 0.5 : (cx - cy) * inv_x2y2;
+      C3s[j] = both_zero ? 1.0 / 6.0 : (sx_x - sy_y) * inv_x2y2;
+      ka[j] = std::exp(ka[j]);
+    }
 
-      const Numeric C0 =
-          either_zero ? 1.0 : ((cy * x2 + cx * y2) * inv_x2y2).real();
-      const Numeric C1 =
-          either_zero ? 1.0 : ((sy * x2 * iy + sx * y2 * ix) * inv_x2y2).real();
-      const Numeric C2 = both_zero ? 0.5 : ((cx - cy) * inv_x2y2).real();
-      const Numeric C3 = both_zero ? 1.0 / 6.0
-                                   : ((x_zero   ? 1.0 - sy * iy
-                                       : y_zero ? sx * ix - 1.0
-                                                : sx * ix - sy * iy) *
-                                      inv_x2y2)
-                                         .real();
-      T.Mat4(i).noalias() =
+    for (Index j = 0; j < n; j++) {
+      const Numeric exp_a = ka[j], b = kb[j], c = kc[j], d = kd[j], u = ku[j],
+                    v = kv[j], w = kw[j];
+      const Numeric b2 = b * b, c2 = c * c, d2 = d * d, u2 = u * u, v2 = v * v,
+                    w2 = w * w;
+      const Numeric C0 = C0s[j], C1 = C1s[j], C2 = C2s[j], C3 = C3s[j];
+
+      T.Mat4(i0 + j).noalias() =
           exp_a * (Eigen::Matrix4d() << C0 + C2 * (b2 + c2 + d2),
                    C1 * b + C2 * (-c * u - d * v) +
                        C3 * (b * (b2 + c2 + d2) - u * (b * u - d * w) -
@@ -1782,19 +1797,31 @@ void stepwise_transmission(TransmissionMatrix& T,
         T, dT1, dT2, K1, K2, dK1, dK2, r, dr_dtemp1, dr_dtemp2, temp_deriv_pos);
 }
 
-void stepwise_source(RadiationVector& J,
-                     ArrayOfRadiationVector& dJ,
-                     RadiationVector& J_add,
-                     const PropagationMatrix& K,
-                     const StokesVector& a,
-                     const StokesVector& S,
-                     const ArrayOfPropagationMatrix& dK,
-                     const ArrayOfStokesVector& da,
-                     const ArrayOfStokesVector& dS,
-                     const ConstVectorView& B,
-                     const ConstVectorView& dB_dT,
-                     const ArrayOfRetrievalQuantity& jacobian_quantities,
-                     const bool& jacobian_do) {
+/** The Stokes components of an absorption or source vector at position i */
+template <int N>
+Eigen::Matrix<Numeric, N, 1> stokes_vector(const StokesVector& a, Index i) {
+  Eigen::Matrix<Numeric, N, 1> out;
+  for (int k = 0; k < N; k++) out[k] = a.Data()(0, 0, i, k);
+  return out;
+}
+
+template <int N>
+void stepwise_source_impl(RadiationVector& J,
+                          ArrayOfRadiationVector& dJ,
+                          RadiationVector& J_add,
+                          const PropagationMatrix& K,
+                          const StokesVector& a,
+                          const StokesVector& S,
+                          const ArrayOfPropagationMatrix& dK,
+                          const ArrayOfStokesVector& da,
+                          const ArrayOfStokesVector& dS,
+                          const ConstVectorView& B,
+                          const ConstVectorView& dB_dT,
+                          const ArrayOfRetrievalQuantity& jacobian_quantities,
+                          const bool& jacobian_do) {
+  const bool scattering = not S.IsEmpty();
+  const bool additional = J_add.Frequencies();
+
   for (Index i = 0; i < K.NumberOfFrequencies(); i++) {
     if (K.IsRotational(i)) {
       J.SetZero(i);
@@ -1803,125 +1830,74 @@ void stepwise_source(RadiationVector& J,
           if (dJ[j].Frequencies()) dJ[j].SetZero(i);
       }
     } else {
-      J.setSource(a, B, S, i);
+      auto& Ji = J.RadVec<N>(i);
+      if (scattering)
+        Ji.noalias() = stokes_vector<N>(a, i) * B[i] + stokes_vector<N>(S, i);
+      else
+        Ji.noalias() = stokes_vector<N>(a, i) * B[i];
 
-      switch (J.stokes_dim) {
-        case 4: {
-          const auto invK = inv_prop_matrix<4>(K.Data()(0, 0, i, joker));
-          J.Vec4(i) = invK * J.Vec4(i);
-          if (jacobian_do) {
-            for (Index j = 0; j < jacobian_quantities.nelem(); j++) {
-              if (dJ[j].Frequencies() == da[j].NumberOfFrequencies() and
-                  dJ[j].Frequencies() == dS[j].NumberOfFrequencies()) {
-                dJ[j].Vec4(i).noalias() =
-                    0.5 * invK *
-                    (source_vector<4>(
-                         a,
-                         B,
-                         da[j],
-                         dB_dT,
-                         dS[j],
-                         jacobian_quantities[j] == Jacobian::Atm::Temperature,
-                         i) -
-                     prop_matrix<4>(dK[j].Data()(0, 0, i, joker)) * J.Vec4(i));
-              }
-            }
-          }
-          if (J_add.Frequencies()) {
-            J_add.Vec4(i) = invK * J_add.Vec4(i);
-            //TODO: Add jacobians dJ_add of additional source
-          }
-        } break;
-        case 3: {
-          const auto invK = inv_prop_matrix<3>(K.Data()(0, 0, i, joker));
-          J.Vec3(i) = invK * J.Vec3(i);
-          if (jacobian_do) {
-            for (Index j = 0; j < jacobian_quantities.nelem(); j++) {
-              // Skip others!
-              if (dJ[j].Frequencies() == da[j].NumberOfFrequencies() and
-                  dJ[j].Frequencies() == dS[j].NumberOfFrequencies()) {
-                dJ[j].Vec3(i).noalias() =
-                    0.5 * invK *
-                    (source_vector<3>(
-                         a,
-                         B,
-                         da[j],
-                         dB_dT,
-                         dS[j],
-                         jacobian_quantities[j] == Jacobian::Atm::Temperature,
-                         i) -
-                     prop_matrix<3>(dK[j].Data()(0, 0, i, joker)) * J.Vec3(i));
-              }
-            }
-          }
-          if (J_add.Frequencies()) {
-            J_add.Vec3(i) = invK * J_add.Vec3(i);
-            //TODO: Add jacobians dJ_add of additional source
-          }
-        } break;
-        case 2: {
-          const auto invK = inv_prop_matrix<2>(K.Data()(0, 0, i, joker));
-          J.Vec2(i) = invK * J.Vec2(i);
-          if (jacobian_do) {
-            for (Index j = 0; j < jacobian_quantities.nelem(); j++) {
-              // Skip others!
-              if (dJ[j].Frequencies() == da[j].NumberOfFrequencies() and
-                  dJ[j].Frequencies() == dS[j].NumberOfFrequencies()) {
-                dJ[j].Vec2(i).noalias() =
-                    0.5 * invK *
-                    (source_vector<2>(
-                         a,
-                         B,
-                         da[j],
-                         dB_dT,
-                         dS[j],
-                         jacobian_quantities[j] == Jacobian::Atm::Temperature,
-                         i) -
-                     prop_matrix<2>(dK[j].Data()(0, 0, i, joker)) * J.Vec2(i));
-              }
-            }
-          }
-          if (J_add.Frequencies()) {
-            J_add.Vec2(i) = invK * J_add.Vec2(i);
-            //TODO: Add jacobians dJ_add of additional source
-          }
-        } break;
-        default: {
-          const auto invK = inv_prop_matrix<1>(K.Data()(0, 0, i, joker));
-          J.Vec1(i) = invK * J.Vec1(i);
-          if (jacobian_do) {
-            for (Index j = 0; j < jacobian_quantities.nelem(); j++) {
-              // Skip others!
-              if (dJ[j].Frequencies() == da[j].NumberOfFrequencies() and
-                  dJ[j].Frequencies() == dS[j].NumberOfFrequencies()) {
-                dJ[j].Vec1(i).noalias() =
-                    0.5 * invK *
-                    (source_vector<1>(
-                         a,
-                         B,
-                         da[j],
-                         dB_dT,
-                         dS[j],
-                         jacobian_quantities[j] == Jacobian::Atm::Temperature,
-                         i) -
-                     prop_matrix<1>(dK[j].Data()(0, 0, i, joker)) * J.Vec1(i));
-              }
-            }
-          }
-          if (J_add.Frequencies()) {
-            J_add.Vec1(i) = invK * J_add.Vec1(i);
-            //TODO: Add jacobians dJ_add of additional source
+      const auto invK = inv_prop_matrix<N>(K.Data()(0, 0, i, joker));
+      Ji = invK * Ji;
+      if (jacobian_do) {
+        for (Index j = 0; j < jacobian_quantities.nelem(); j++) {
+          // Skip others!
+          if (dJ[j].Frequencies() == da[j].NumberOfFrequencies() and
+              dJ[j].Frequencies() == dS[j].NumberOfFrequencies()) {
+            dJ[j].RadVec<N>(i).noalias() =
+                0.5 * invK *
+                (source_vector<N>(
+                     a,
+                     B,
+                     da[j],
+                     dB_dT,
+                     dS[j],
+                     jacobian_quantities[j] == Jacobian::Atm::Temperature,
+                     i) -
+                 prop_matrix<N>(dK[j].Data()(0, 0, i, joker)) * Ji);
           }
-        } break;
+        }
+      }
+      if (additional) {
+        J_add.RadVec<N>(i) = invK * J_add.RadVec<N>(i);
+        //TODO: Add jacobians dJ_add of additional source
       }
     }
   }
 
-  if (J_add.Frequencies()) {
+  if (additional) {
     J += J_add;
   }
 }
 
+void stepwise_source(RadiationVector& J,
+                     ArrayOfRadiationVector& dJ,
+                     RadiationVector& J_add,
+                     const PropagationMatrix& K,
+                     const StokesVector& a,
+                     const StokesVector& S,
+                     const ArrayOfPropagationMatrix& dK,
+                     const ArrayOfStokesVector& da,
+                     const ArrayOfStokesVector& dS,
+                     const ConstVectorView& B,
+                     const ConstVectorView& dB_dT,
+                     const ArrayOfRetrievalQuantity& jacobian_quantities,
+                     const bool& jacobian_do) {
+  switch (J.stokes_dim) {
+    case 4:
+      stepwise_source_impl<4>(J, dJ, J_add, K, a, S, dK, da, dS, B, dB_dT, jacobian_quantities, jacobian_do);
+      break;
+    case 3:
+      stepwise_source_impl<3>(J, dJ, J_add, K, a, S, dK, da, dS, B, dB_dT, jacobian_quantities, jacobian_do);
+      break;
+    case 2:
+      stepwise_source_impl<2>(J, dJ, J_add, K, a, S, dK, da, dS, B, dB_dT, jacobian_quantities, jacobian_do);
+      break;
+    default:
+      stepwise_source_impl<1>(J, dJ, J_add, K, a, S, dK, da, dS, B, dB_dT, jacobian_quantities, jacobian_do);
+      break;
+  }
+}
+
 void update_radiation_vector(
     RadiationVector& I,
     ArrayOfRadiationVector& dI1,
@@ -1980,6 +1956,48 @@ void update_radiation_vector(
   }
 }
 
+void stepwise_scalar_source(VectorView J,
+                            const PropagationMatrix& K,
+                            const StokesVector& a,
+                            const StokesVector& S,
+                            const ConstVectorView& B) {
+  ARTS_ASSERT(K.StokesDimensions() == 1);
+
+  const auto k = K.Kjj();
+  const auto ka = a.Kjj();
+  const Index nf = J.nelem();
+  if (S.IsEmpty()) {
+    for (Index i = 0; i < nf; i++)
+      J[i] = k[i] == 0.0 ? 0.0 : (1 / k[i]) * (ka[i] * B[i]);
+  } else {
+    const auto s = S.Kjj();
+    for (Index i = 0; i < nf; i++)
+      J[i] = k[i] == 0.0 ? 0.0 : (1 / k[i]) * (ka[i] * B[i] + s[i]);
+  }
+}
+
+void stepwise_scalar_transmission(VectorView T,
+                                  const PropagationMatrix& K1,
+                                  const PropagationMatrix& K2,
+                                  const Numeric r) {
+  ARTS_ASSERT(K1.StokesDimensions() == 1 and K2.StokesDimensions() == 1);
+
+  const auto k1 = K1.Kjj();
+  const auto k2 = K2.Kjj();
+  for (Index i = 0; i < T.nelem(); i++)
+    T[i] = std::exp(-0.5 * r * (k1[i] + k2[i]));
+}
+
+void update_scalar_radiation(VectorView I,
+                             const ConstVectorView& J1,
+                             const ConstVectorView& J2,
+                             const ConstVectorView& T) {
+  for (Index i = 0; i < I.nelem(); i++) {
+    const Numeric J = 0.5 * (J1[i] + J2[i]);
+    I[i] = T[i] * (I[i] - J) + J;
+  }
+}
+
 ArrayOfTransmissionMatrix cumulative_transmission(
     const ArrayOfTransmissionMatrix& T,
     const CumulativeTransmission type) /*[[expects: T.nelem()>0]]*/
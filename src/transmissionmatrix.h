@@ -601,6 +601,34 @@ struct RadiationVector {
    */
   Eigen::Matrix<double, 1, 1>& Vec1(size_t i);
 
+  /** Simple template access for the radiation */
+  template <int N>
+  auto& RadVec(size_t i) noexcept {
+    static_assert(N > 0 and N < 5, "Bad size N");
+    if constexpr (N == 1)
+      return R1[i];
+    else if constexpr (N == 2)
+      return R2[i];
+    else if constexpr (N == 3)
+      return R3[i];
+    else if constexpr (N == 4)
+      return R4[i];
+  }
+
+  /** Simple template access for the radiation */
+  template <int N>
+  [[nodiscard]] auto& RadVec(size_t i) const noexcept {
+    static_assert(N > 0 and N < 5, "Bad size N");
+    if constexpr (N == 1)
+      return R1[i];
+    else if constexpr (N == 2)
+      return R2[i];
+    else if constexpr (N == 3)
+      return R3[i];
+    else if constexpr (N == 4)
+      return R4[i];
+  }
+
   /** Remove the average of two other RadiationVector from *this
    * 
    * @param[in] O1 Input 1
@@ -887,6 +915,54 @@ void stepwise_transmission(TransmissionMatrix& T,
                            const Numeric& dr_dtemp2,
                            const Index temp_deriv_pos);
 
+/** Set the stepwise source of unpolarized radiation
+ *
+ * Scalar version of stepwise_source() for Stokes dimension 1 without
+ * derivatives or additional sources.  Rotational (zero absorption)
+ * frequencies get a zero source, as in stepwise_source().
+ *
+ * @param[out] J Source per frequency
+ * @param[in] K Propagation matrix
+ * @param[in] a Absorption vector
+ * @param[in] S Scattering source vector
+ * @param[in] B Planck vector
+ */
+void stepwise_scalar_source(VectorView J,
+                            const PropagationMatrix& K,
+                            const StokesVector& a,
+                            const StokesVector& S,
+                            const ConstVectorView& B);
+
+/** Set the stepwise transmission of unpolarized radiation
+ *
+ * Scalar version of stepwise_transmission() for Stokes dimension 1
+ * without derivatives, i.e., exp(-r (K1 + K2) / 2) per frequency.
+ *
+ * @param[out] T Transmission per frequency
+ * @param[in] K1 Propagation matrix wrt level 1
+ * @param[in] K2 Propagation matrix wrt level 2
+ * @param[in] r Distance through layer
+ */
+void stepwise_scalar_transmission(VectorView T,
+                                  const PropagationMatrix& K1,
+                                  const PropagationMatrix& K2,
+                                  const Numeric r);
+
+/** Update the unpolarized radiation through a layer
+ *
+ * Scalar version of update_radiation_vector() for Stokes dimension 1 and
+ * RadiativeTransferSolver::Emission without derivatives.
+ *
+ * @param[in,out] I Radiation per frequency
+ * @param[in] J1 Source from level 1
+ * @param[in] J2 Source from level 2
+ * @param[in] T Transmission through layer
+ */
+void update_scalar_radiation(VectorView I,
+                             const ConstVectorView& J1,
+                             const ConstVectorView& J2,
+                             const ConstVectorView& T);
+
 /** Accumulate the transmission matrix over all layers
  * 
  * @param[in] T Transmission matrix through all layers
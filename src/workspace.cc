@@ -2136,6 +2136,23 @@ This variable is set to the default provided by *isotopologue_ratiosInitFromBuil
           "Unit:  degrees\n"),
       GROUP("Vector"), Vector{}));
 
+  wsv_data.push_back(WsvRecord(
+    NAME("lbl_cache_size"),
+      DESCRIPTION("Number of atmospheric states to cache line parameters for\n"
+                  "\n"
+                  "Each absorption band then keeps its line shape parameters,\n"
+                  "partition functions, and line strengths for this many of the\n"
+                  "most recently used combinations of temperature, pressure, and\n"
+                  "VMRs.  This speeds up repeated calculations with the same\n"
+                  "atmosphere, e.g., in Jacobian and retrieval loops, at the cost\n"
+                  "of memory per line and state.  Bands with NLTE populations and\n"
+                  "line shapes that are split per broadener are not cached.\n"
+                  "\n"
+                  "Usage: Set by the user.  The default, 0, is no caching.\n"
+                  "\n"
+                  "Unit:  Index\n"),
+      GROUP("Index"), Index{0}));
+
   wsv_data.push_back(WsvRecord(
     NAME("lbl_checked"),
       DESCRIPTION("Flag to check if the line-by-line calculations will work\n"
@@ -3157,6 +3174,32 @@ This variable is set to the default provided by *isotopologue_ratiosInitFromBuil
                 DESCRIPTION("Agenda calculating a propagation path step.\n"),
                 GROUP("Agenda")));
 
+  wsv_data.push_back(WsvRecord(
+      NAME("ppvar_dnlte_source"),
+      DESCRIPTION(
+          "Derivatives of *ppvar_nlte_source* with respect to the\n"
+          "*jacobian_quantities*.\n"
+          "\n"
+          "See *ppvar_p* for a general description of WSVs of ppvar-type.\n"
+          "\n"
+          "Dimension: [ ppath.np, number of retrieval quantities ]\n"
+          "\n"
+          "Usage: Output of *ppvar_propmat_agenda*.\n"),
+      GROUP("ArrayOfArrayOfStokesVector")));
+
+  wsv_data.push_back(WsvRecord(
+      NAME("ppvar_dpropmat"),
+      DESCRIPTION(
+          "Derivatives of *ppvar_propmat* with respect to the\n"
+          "*jacobian_quantities*.\n"
+          "\n"
+          "See *ppvar_p* for a general description of WSVs of ppvar-type.\n"
+          "\n"
+          "Dimension: [ ppath.np, number of retrieval quantities ]\n"
+          "\n"
+          "Usage: Output of *ppvar_propmat_agenda*.\n"),
+      GROUP("ArrayOfArrayOfPropagationMatrix")));
+
   wsv_data.push_back(WsvRecord(
       NAME("ppvar_f"),
       DESCRIPTION(
@@ -3205,6 +3248,20 @@ This variable is set to the default provided by *isotopologue_ratiosInitFromBuil
           "Usage: Output of radiative transfer methods.\n"),
       GROUP("EnergyLevelMap")));
 
+  wsv_data.push_back(WsvRecord(
+      NAME("ppvar_nlte_source"),
+      DESCRIPTION(
+          "Non-LTE source terms along the propagation path.\n"
+          "\n"
+          "As *nlte_source*, but for all points of the propagation path.\n"
+          "\n"
+          "See *ppvar_p* for a general description of WSVs of ppvar-type.\n"
+          "\n"
+          "Dimension: [ ppath.np ]\n"
+          "\n"
+          "Usage: Output of *ppvar_propmat_agenda*.\n"),
+      GROUP("ArrayOfStokesVector")));
+
   wsv_data.push_back(WsvRecord(
       NAME("ppvar_p"),
       DESCRIPTION(
@@ -3231,6 +3288,26 @@ This variable is set to the default provided by *isotopologue_ratiosInitFromBuil
           "Usage: Output of radiative transfer methods.\n"),
       GROUP("Matrix")));
 
+  wsv_data.push_back(WsvRecord(
+      NAME("ppvar_propmat"),
+      DESCRIPTION(
+          "Gas absorption along the propagation path.\n"
+          "\n"
+          "As *propmat_clearsky*, but for all points of the propagation path.\n"
+          "\n"
+          "See *ppvar_p* for a general description of WSVs of ppvar-type.\n"
+          "\n"
+          "Dimension: [ ppath.np ]\n"
+          "\n"
+          "Usage: Output of *ppvar_propmat_agenda*.\n"),
+      GROUP("ArrayOfPropagationMatrix")));
+
+  wsv_data.push_back(
+      WsvRecord(NAME("ppvar_propmat_agenda"),
+                DESCRIPTION("Agenda calculating the absorption coefficient matrices\n"
+                            "along a propagation path.\n"),
+                GROUP("Agenda")));
+
   wsv_data.push_back(WsvRecord(
       NAME("ppvar_optical_depth"),
       DESCRIPTION(
@@ -25,12 +25,12 @@ using global_data::workspace_memory_handler;
 Index Workspace::add_wsv(const WsvRecord &wsv) {
   wsv_data_ptr->push_back(wsv);
   WsvMap_ptr->operator[](wsv.Name()) = wsv_data_ptr->nelem() - 1;
-  ws.emplace_back();
+  stack(wsv_data_ptr->nelem() - 1);
   return wsv_data_ptr->nelem() - 1;
 }
 
 void Workspace::set_empty(Index i) {
-  if (ws[i].size()) {
+  if (stack(i).size()) {
     ws[i].pop();
     emplace(i);
   }
@@ -41,7 +41,7 @@ void Workspace::duplicate(Index i) {
 
   WorkspaceVariableStruct wsvs;
 
-  if (ws[i].size()) {
+  if (stack(i).size()) {
     wsvs.wsv = workspace_memory_handler.duplicate((*wsv_data_ptr)[i].Group(),
                                                   ws[i].top().wsv);
     wsvs.initialized = true;
@@ -58,20 +58,42 @@ void Workspace::duplicate(Index i) {
 
 Workspace::Workspace(const Workspace &workspace)
     : std::enable_shared_from_this<Workspace>(),
-      ws(workspace.ws.nelem()),
+      ws(workspace.nelem()),
       wsv_data_ptr(workspace.wsv_data_ptr),
       WsvMap_ptr(workspace.WsvMap_ptr),
       original_workspace(workspace.original_workspace) {
-  for (Index i = 0; i < workspace.ws.nelem(); i++) {
-    if (workspace.ws[i].size() && workspace.ws[i].top().wsv) {
-      WorkspaceVariableStruct wsvs;
-      wsvs.wsv = workspace.ws[i].top().wsv;
-      wsvs.initialized = workspace.ws[i].top().initialized;
-      ws[i].push(std::move(wsvs));
-    }
+  for (Index i = 0; i < workspace.nelem(); i++) {
+    if (auto *wsvs = workspace.top(i); wsvs and wsvs->wsv) ws[i].push(*wsvs);
   }
 }
 
+Workspace::Workspace(std::shared_ptr<const Workspace> parent_)
+    : std::enable_shared_from_this<Workspace>(),
+      parent(std::move(parent_)),
+      wsv_data_ptr(parent->wsv_data_ptr),
+      WsvMap_ptr(parent->WsvMap_ptr),
+      original_workspace(parent->original_workspace) {}
+
+void Workspace::take_over(Index i) {
+  // The stacks are only allocated once the fork changes anything, and
+  // grow if WSVs have been added through another workspace since
+  if (local.size() <= static_cast<std::size_t>(i)) {
+    ws.resize(nelem());
+    local.resize(nelem(), false);
+  }
+
+  if (local[i]) return;
+  local[i] = true;
+
+  if (auto *wsvs = parent->top(i); wsvs and wsvs->wsv) ws[i].push(*wsvs);
+}
+
+const WorkspaceVariableStruct *Workspace::top(Index i) const {
+  if (parent and (static_cast<std::size_t>(i) >= local.size() or not local[i]))
+    return parent->top(i);
+  return i < ws.nelem() and ws[i].size() ? &ws[i].top() : nullptr;
+}
+
 void Workspace::claim_agenda_ownership() {
   for (Index i=0; i<nelem(); i++) {
     if (is_initialized(i)) {
@@ -90,10 +112,12 @@ void Workspace::claim_agenda_ownership() {
 }
 
 void Workspace::pop(Index i) {
-  ws[i].pop(); }
+  stack(i).pop(); }
 
 void Workspace::swap(Workspace &other) noexcept {
   ws.swap(other.ws);
+  parent.swap(other.parent);
+  local.swap(other.local);
   wsv_data_ptr.swap(other.wsv_data_ptr);
   WsvMap_ptr.swap(other.WsvMap_ptr);
   std::swap(original_workspace, other.original_workspace);
@@ -104,27 +128,35 @@ void Workspace::swap(Workspace &other) noexcept {
 }
 
 bool Workspace::is_initialized(Index i) const {
-  return ws[i].size() and ws[i].top().initialized;
+  const auto *wsvs = top(i);
+  return wsvs and wsvs->initialized;
 }
 
-Index Workspace::depth(Index i) const { return static_cast<Index>(ws[i].size()); }
+Index Workspace::depth(Index i) const {
+  if (parent and (static_cast<std::size_t>(i) >= local.size() or not local[i])) {
+    const auto *wsvs = parent->top(i);
+    return wsvs and wsvs->wsv ? 1 : 0;
+  }
+  return i < ws.nelem() ? static_cast<Index>(ws[i].size()) : 0;
+}
 
 void Workspace::emplace(Index i) {
   static const auto agenda_index = global_data::WsvGroupMap.at("Agenda");
 
   if ((*wsv_data_ptr)[i].Group() == agenda_index) {
-    ws[i].emplace(
+    stack(i).emplace(
         WorkspaceVariableStruct{std::make_shared<Agenda>(*this), false});
   } else {
-    ws[i].emplace(WorkspaceVariableStruct{
+    stack(i).emplace(WorkspaceVariableStruct{
         workspace_memory_handler.allocate((*wsv_data_ptr)[i].Group()), false});
   }
 }
 
 std::shared_ptr<void> Workspace::operator[](Index i) {
-  if (ws[i].size() == 0) emplace(i);
-  ws[i].top().initialized = true;
-  return ws[i].top().wsv;
+  auto &wsv = stack(i);
+  if (wsv.size() == 0) emplace(i);
+  wsv.top().initialized = true;
+  return wsv.top().wsv;
 }
 
 Workspace::Workspace()
@@ -158,7 +190,7 @@ std::shared_ptr<Workspace> Workspace::deepcopy() {
       // Set the WSV by copying the top value
       out->ws[i].emplace(WorkspaceVariableStruct{
           workspace_memory_handler.duplicate(
-              wsv_data_ptr->operator[](i).Group(), ws[i].top().wsv),
+              wsv_data_ptr->operator[](i).Group(), top(i)->wsv),
           is_initialized(i)});
 
       // Copy the agenda to the new workspace
@@ -225,3 +257,8 @@ std::shared_ptr<Workspace> Workspace::shallowcopy() const {
   auto mout = Workspace{*this};
   return std::make_shared<Workspace>(std::move(mout));
 }
+
+std::shared_ptr<Workspace> Workspace::fork() const {
+  auto mout = Workspace{shared_from_this()};
+  return std::make_shared<Workspace>(std::move(mout));
+}
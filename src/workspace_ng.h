@@ -49,8 +49,48 @@ class Workspace final : public std::enable_shared_from_this<Workspace> {
    */
   Workspace(const Workspace &workspace);
 
+  /** Workspace fork constructor.
+   *
+   * Creates an empty overlay of parent, see fork().
+   *
+   * @param[in] parent The workspace to read not yet written WSVs from
+   */
+  explicit Workspace(std::shared_ptr<const Workspace> parent);
+
   void claim_agenda_ownership();
 
+  /** Parent of a forked workspace, the top of its WSV stacks is read until
+   * this workspace first changes the WSV.  Empty if not a fork. */
+  std::shared_ptr<const Workspace> parent{};
+
+  /** Flags for a fork which WSVs have been taken over from the parent */
+  std::vector<bool> local{};
+
+  /** Take the topmost value of WSV i over from the parent */
+  void take_over(Index i);
+
+  /** The stack of WSV i, taken over from the parent first for a fork
+   *
+   * The WSV data is shared with shallow copies and forks, so WSV i may have
+   * been added through another workspace.  The stacks grow to match.
+   */
+  WorkspaceVariable &stack(Index i) {
+    if (parent) {
+      if (static_cast<std::size_t>(i) >= local.size() or not local[i])
+        take_over(i);
+    } else if (i >= ws.nelem()) {
+      ws.resize(nelem());
+    }
+    return ws[i];
+  }
+
+  /** The topmost value of WSV i or nullptr if there is none
+   *
+   * Also nullptr if WSV i was added through another workspace sharing
+   * the WSV data and has never been set in this workspace.
+   */
+  [[nodiscard]] const WorkspaceVariableStruct *top(Index i) const;
+
  public:
   /** Workspace variable container. */
   Array<WorkspaceVariable> ws;
@@ -69,6 +109,16 @@ class Workspace final : public std::enable_shared_from_this<Workspace> {
   //! Shallow copy of a Workspace, it has to be created as a shared pointer
   [[nodiscard]] std::shared_ptr<Workspace> shallowcopy() const;
 
+  /** Copy-on-write copy of a Workspace, it has to be created as a shared pointer
+   *
+   * Unlike shallowcopy(), nothing is copied up front.  The fork reads the
+   * topmost value of each WSV from this workspace until it first changes
+   * the WSV stack, so creating it is O(1).  This workspace must not be
+   * changed while the fork is in use, as is the case for the copies made
+   * by OmpParallelCopyGuard.
+   */
+  [[nodiscard]] std::shared_ptr<Workspace> fork() const;
+
   //! Allow move construction of this object in public
   Workspace(Workspace&&) noexcept = default;
 
@@ -123,8 +173,9 @@ class Workspace final : public std::enable_shared_from_this<Workspace> {
     WorkspaceVariableStruct wsvs;
     wsvs.initialized = true;
     wsvs.wsv = wsv_ptr;
-    ws[i].push(wsvs);
-    return {ws[i]};
+    auto &stk = stack(i);
+    stk.push(wsvs);
+    return {stk};
   }
 
   /** Put a new WSV onto its stack.
@@ -141,8 +192,9 @@ class Workspace final : public std::enable_shared_from_this<Workspace> {
     WorkspaceVariableStruct wsvs;
     wsvs.initialized = false;
     wsvs.wsv = wsv_ptr;
-    ws[i].push(wsvs);
-    return {ws[i]};
+    auto &stk = stack(i);
+    stk.push(wsvs);
+    return {stk};
   }
 
   /** Move a WSV onto its stack.
@@ -157,11 +209,15 @@ class Workspace final : public std::enable_shared_from_this<Workspace> {
     WorkspaceVariableStruct wsvs;
     wsvs.initialized = true;
     wsvs.wsv = std::forward<std::shared_ptr<T>>(wsv_ptr);
-    ws[i].push(std::move(wsvs));
+    stack(i).push(std::move(wsvs));
   }
 
-  /** Get the number of workspace variables. */
-  [[nodiscard]] Index nelem() const { return ws.nelem(); }
+  /** Get the number of workspace variables.
+   *
+   * This counts all WSVs of the shared WSV data, including those added
+   * through another workspace sharing it.
+   */
+  [[nodiscard]] Index nelem() const { return wsv_data_ptr->nelem(); }
 
   /** Add a new variable to this workspace */
   Index add_wsv(const WsvRecord &wsv);
@@ -173,7 +229,7 @@ class Workspace final : public std::enable_shared_from_this<Workspace> {
   template <class T>
   T* get(const char *name) {
     if (const Index pos = WsvMap_ptr -> at(name); is_initialized(pos)) {
-      return static_cast<T*>(ws[pos].top().wsv.get());
+      return static_cast<T*>(top(pos)->wsv.get());
     }
     return nullptr;
   }
@@ -217,6 +273,15 @@ std::shared_ptr<T> get_shallow_copy(const T& x) {
   else { T mout{x}; return std::make_shared<T>(std::move(mout)); }
 }
 
+template <typename T>
+concept ForkConstructor = requires(const T& a) {a.fork();};
+
+template <typename T>
+std::shared_ptr<T> get_parallel_copy(const T& x) {
+  if constexpr (ForkConstructor<T>) return x.fork();
+  else return get_shallow_copy(x);
+}
+
 template <CanCopy T>
 class OmpParallelCopyGuard {
   T &orig;
@@ -235,7 +300,7 @@ class OmpParallelCopyGuard {
   OmpParallelCopyGuard(const OmpParallelCopyGuard &cp)
     : orig(cp.orig),
       do_copy(cp.do_copy),
-      copy(do_copy ? get_shallow_copy(orig) : nullptr) {}
+      copy(do_copy ? get_parallel_copy(orig) : nullptr) {}
 
   operator T &() { return copy ? *copy : orig; }
 
@@ -324,6 +324,121 @@ void xml_write_to_stream(ostream& os_xml,
 
 //=== GasAbsLookup ===========================================================
 
+//! Reads reduced precision lookup table cross sections from XML input stream
+/*!
+  \param is_xml  XML Input stream
+  \param ccs     CompactCrossSections return value
+  \param pbifs   Pointer to binary input stream. NULL in case of ASCII file.
+*/
+static void xml_read_from_stream(istream& is_xml,
+                                 CompactCrossSections& ccs,
+                                 bifstream* pbifs,
+                                 const Verbosity& verbosity) {
+  ArtsXMLTag tag(verbosity);
+  String storage;
+
+  tag.read_from_stream(is_xml);
+  tag.check_name("CompactCrossSections");
+
+  tag.get_attribute_value("storage", storage);
+  ccs.storage = toGasAbsLookupStorageOrThrow(storage);
+  ARTS_USER_ERROR_IF(ccs.storage == GasAbsLookupStorage::Double,
+                     "Compact cross sections cannot be of double precision")
+  tag.get_attribute_value("nbooks", ccs.shape[0]);
+  tag.get_attribute_value("npages", ccs.shape[1]);
+  tag.get_attribute_value("nrows", ccs.shape[2]);
+  tag.get_attribute_value("ncols", ccs.shape[3]);
+  const Index n = ccs.shape[0] * ccs.shape[1] * ccs.shape[2] * ccs.shape[3];
+
+  if (ccs.storage == GasAbsLookupStorage::Log16) {
+    xml_read_from_stream(is_xml, ccs.log_offset, pbifs, verbosity);
+    xml_read_from_stream(is_xml, ccs.log_step, pbifs, verbosity);
+    ARTS_USER_ERROR_IF(
+        not is_size(ccs.log_offset, ccs.shape[0], ccs.shape[1], ccs.shape[3]) or
+            not is_size(ccs.log_step, ccs.shape[0], ccs.shape[1], ccs.shape[3]),
+        "Bad size of the offsets or steps of the compact cross sections")
+
+    ccs.q16.resize(n);
+    for (auto& q : ccs.q16) {
+      if (pbifs) {
+        q = static_cast<std::uint16_t>(pbifs->readInt(2));
+      } else {
+        Index x;
+        is_xml >> x;
+        q = static_cast<std::uint16_t>(x);
+      }
+      if (is_xml.fail()) xml_data_parse_error(tag, "");
+    }
+  } else {
+    ccs.f32.resize(n);
+    for (auto& x : ccs.f32) {
+      if (pbifs) {
+        x = static_cast<float>(pbifs->readFloat(binio::Single));
+      } else {
+        Numeric v;
+        is_xml >> double_imanip() >> v;
+        x = static_cast<float>(v);
+      }
+      if (is_xml.fail()) xml_data_parse_error(tag, "");
+    }
+  }
+
+  tag.read_from_stream(is_xml);
+  tag.check_name("/CompactCrossSections");
+}
+
+//! Writes reduced precision lookup table cross sections to XML output stream
+/*!
+  \param os_xml  XML Output stream
+  \param ccs     CompactCrossSections
+  \param pbofs   Pointer to binary file stream. NULL for ASCII output.
+  \param name    Optional name attribute
+*/
+static void xml_write_to_stream(ostream& os_xml,
+                                const CompactCrossSections& ccs,
+                                bofstream* pbofs,
+                                const String& name,
+                                const Verbosity& verbosity) {
+  ArtsXMLTag open_tag(verbosity);
+  ArtsXMLTag close_tag(verbosity);
+
+  open_tag.set_name("CompactCrossSections");
+  if (name.length()) open_tag.add_attribute("name", name);
+  open_tag.add_attribute("storage", String{toString(ccs.storage)});
+  open_tag.add_attribute("nbooks", ccs.shape[0]);
+  open_tag.add_attribute("npages", ccs.shape[1]);
+  open_tag.add_attribute("nrows", ccs.shape[2]);
+  open_tag.add_attribute("ncols", ccs.shape[3]);
+  open_tag.write_to_stream(os_xml);
+  os_xml << '\n';
+
+  if (ccs.storage == GasAbsLookupStorage::Log16) {
+    xml_write_to_stream(os_xml, ccs.log_offset, pbofs, "LogOffset", verbosity);
+    xml_write_to_stream(os_xml, ccs.log_step, pbofs, "LogStep", verbosity);
+
+    for (std::size_t i = 0; i < ccs.q16.size(); i++) {
+      if (pbofs)
+        pbofs->writeInt(ccs.q16[i], 2);
+      else
+        os_xml << ccs.q16[i] << ((i + 1) % ccs.shape[3] ? ' ' : '\n');
+    }
+  } else {
+    xml_set_stream_precision(os_xml);
+    os_xml << std::setprecision(std::numeric_limits<float>::max_digits10);
+
+    for (std::size_t i = 0; i < ccs.f32.size(); i++) {
+      if (pbofs)
+        pbofs->writeFloat(ccs.f32[i], binio::Single);
+      else
+        os_xml << ccs.f32[i] << ((i + 1) % ccs.shape[3] ? ' ' : '\n');
+    }
+  }
+
+  close_tag.set_name("/CompactCrossSections");
+  close_tag.write_to_stream(os_xml);
+  os_xml << '\n';
+}
+
 //! Reads GasAbsLookup from XML input stream
 /*!
   \param is_xml  XML Input stream
@@ -339,6 +454,14 @@ void xml_read_from_stream(istream& is_xml,
   tag.read_from_stream(is_xml);
   tag.check_name("GasAbsLookup");
 
+  // Tables in reduced precision have a storage attribute
+  gal.xsec_compact = CompactCrossSections{};
+  if (tag.has_attribute("storage")) {
+    String storage;
+    tag.get_attribute_value("storage", storage);
+    gal.xsec_compact.storage = toGasAbsLookupStorageOrThrow(storage);
+  }
+
   xml_read_from_stream(is_xml, gal.species, pbifs, verbosity);
   xml_read_from_stream(is_xml, gal.nonlinear_species, pbifs, verbosity);
   xml_read_from_stream(is_xml, gal.f_grid, pbifs, verbosity);
@@ -347,7 +470,12 @@ void xml_read_from_stream(istream& is_xml,
   xml_read_from_stream(is_xml, gal.t_ref, pbifs, verbosity);
   xml_read_from_stream(is_xml, gal.t_pert, pbifs, verbosity);
   xml_read_from_stream(is_xml, gal.nls_pert, pbifs, verbosity);
-  xml_read_from_stream(is_xml, gal.xsec, pbifs, verbosity);
+  if (gal.xsec_compact.storage == GasAbsLookupStorage::Double) {
+    xml_read_from_stream(is_xml, gal.xsec, pbifs, verbosity);
+  } else {
+    gal.xsec = Tensor4{};
+    xml_read_from_stream(is_xml, gal.xsec_compact, pbifs, verbosity);
+  }
 
   tag.read_from_stream(is_xml);
   tag.check_name("/GasAbsLookup");
@@ -370,6 +498,8 @@ void xml_write_to_stream(ostream& os_xml,
 
   open_tag.set_name("GasAbsLookup");
   if (name.length()) open_tag.add_attribute("name", name);
+  if (gal.Storage() != GasAbsLookupStorage::Double)
+    open_tag.add_attribute("storage", String{toString(gal.Storage())});
   open_tag.write_to_stream(os_xml);
 
   xml_write_to_stream(os_xml, gal.species, pbofs, "", verbosity);
@@ -388,8 +518,12 @@ void xml_write_to_stream(ostream& os_xml,
                       pbofs,
                       "NonlinearSpeciesVmrPerturbations",
                       verbosity);
-  xml_write_to_stream(
-      os_xml, gal.xsec, pbofs, "AbsorptionCrossSections", verbosity);
+  if (gal.Storage() == GasAbsLookupStorage::Double)
+    xml_write_to_stream(
+        os_xml, gal.xsec, pbofs, "AbsorptionCrossSections", verbosity);
+  else
+    xml_write_to_stream(
+        os_xml, gal.xsec_compact, pbofs, "AbsorptionCrossSections", verbosity);
 
   close_tag.set_name("/GasAbsLookup");
   close_tag.write_to_stream(os_xml);
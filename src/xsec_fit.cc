@@ -141,17 +141,14 @@ void XsecRecord::Extract(VectorView result,
     const Range active_range(i_data_fstart, data_f_extent);
     const ConstVectorView data_f_grid_active = data_f_grid[active_range];
 
-    Vector fit_result(data_f_grid.nelem());
-    VectorView fit_result_active = fit_result[active_range];
+    const Vector fit_result =
+        Spectrum(this_dataset_i, pressure, temperature);
+    const ConstVectorView fit_result_active = fit_result[active_range];
 
     // We have to create a matching view on the result vector:
     VectorView result_active = result[Range(i_fstart, f_extent)];
     Vector xsec_interp(f_extent);
 
-    CalcXsec(fit_result, this_dataset_i, pressure, temperature);
-
-    RemoveNegativeXsec(fit_result);
-
     // Check if frequency is inside the range covered by the data:
     chk_interpolation_grids("Frequency interpolation for cross sections",
                             data_f_grid,
@@ -171,6 +168,15 @@ void XsecRecord::Extract(VectorView result,
   }
 }
 
+Vector XsecRecord::Spectrum(Index dataset,
+                            Numeric pressure,
+                            Numeric temperature) const {
+  Vector xsec(mfitcoeffs[dataset].get_numeric_grid(0).nelem());
+  CalcXsec(xsec, dataset, pressure, temperature);
+  RemoveNegativeXsec(xsec);
+  return xsec;
+}
+
 void XsecRecord::CalcXsec(VectorView xsec,
                           const Index dataset,
                           const Numeric pressure,
@@ -222,8 +228,8 @@ Index hitran_xsec_get_index(const ArrayOfXsecRecord& xsec_data,
 
  \returns Correct CIA record or nullptr if not found.
  */
-std::shared_ptr<XsecRecord> hitran_xsec_get_data(
-    const std::vector<std::shared_ptr<XsecRecord>>& xsec_data,
+std::shared_ptr<const XsecRecord> hitran_xsec_get_data(
+    const std::vector<std::shared_ptr<const XsecRecord>>& xsec_data,
     const Species::Species species) {
   for (auto& xsec : xsec_data) {
     if (xsec->Species() == species) return xsec;
@@ -59,6 +59,20 @@ class XsecRecord {
                Numeric temperature,
                const Verbosity& verbosity) const;
 
+  /** Calculate the cross section spectrum of one dataset.
+
+     The fitted crosssections are evaluated on the frequency grid of the
+     dataset and negative values are removed, as is done by Extract.
+
+     \param[in] dataset     Dataset index.
+     \param[in] pressure    Scalar pressure.
+     \param[in] temperature Scalar temperature.
+     \return Crosssections on the frequency grid of the dataset.
+     */
+  [[nodiscard]] Vector Spectrum(Index dataset,
+                                Numeric pressure,
+                                Numeric temperature) const;
+
   /************ VERSION 2 *************/
   /** Get mininum pressures from fit */
   [[nodiscard]] const Vector& FitMinPressures() const {
@@ -139,8 +153,8 @@ using ArrayOfXsecRecord = Array<XsecRecord>;
 Index hitran_xsec_get_index(const ArrayOfXsecRecord& xsec_data,
                             Species::Species species);
 
-std::shared_ptr<XsecRecord> hitran_xsec_get_data(
-    const std::vector<std::shared_ptr<XsecRecord>>& xsec_data,
+std::shared_ptr<const XsecRecord> hitran_xsec_get_data(
+    const std::vector<std::shared_ptr<const XsecRecord>>& xsec_data,
     const Species::Species species);
 
 #endif  // HITRAN_XSEC_H
@@ -140,19 +140,19 @@ void zeeman_on_the_fly(
       if (not deriv.propmattype()) continue;
       
       if (deriv == Jacobian::Atm::MagneticU) {
-        Zeeman::dsum(dpropmat_clearsky_dx[j], com.F, com.dF(joker, j),
+        Zeeman::dsum(dpropmat_clearsky_dx[j], com.F, com.dF(j, joker),
                       pol, dpol_dtheta, dpol_deta,
                       X.dH_du, X.dtheta_du, X.deta_du);
       } else if (deriv == Jacobian::Atm::MagneticV) {
-        Zeeman::dsum(dpropmat_clearsky_dx[j], com.F, com.dF(joker, j),
+        Zeeman::dsum(dpropmat_clearsky_dx[j], com.F, com.dF(j, joker),
                       pol, dpol_dtheta, dpol_deta,
                       X.dH_dv, X.dtheta_dv, X.deta_dv);
       } else if (deriv == Jacobian::Atm::MagneticW) {
-        Zeeman::dsum(dpropmat_clearsky_dx[j], com.F, com.dF(joker, j),
+        Zeeman::dsum(dpropmat_clearsky_dx[j], com.F, com.dF(j, joker),
                       pol, dpol_dtheta, dpol_deta,
                       X.dH_dw, X.dtheta_dw, X.deta_dw);
       } else {
-        Zeeman::sum(dpropmat_clearsky_dx[j], com.dF(joker, j), pol);
+        Zeeman::sum(dpropmat_clearsky_dx[j], com.dF(j, joker), pol);
       }
     }
     
@@ -167,19 +167,19 @@ void zeeman_on_the_fly(
         if (not deriv.propmattype()) continue;
         
         if (deriv == Jacobian::Atm::MagneticU) {
-          Zeeman::dsum(dnlte_source_dx[j], com.N, com.dN(joker, j),
+          Zeeman::dsum(dnlte_source_dx[j], com.N, com.dN(j, joker),
                         pol, dpol_dtheta, dpol_deta,
                         X.dH_du, X.dtheta_du, X.deta_du, false);
         } else if (deriv == Jacobian::Atm::MagneticV) {
-          Zeeman::dsum(dnlte_source_dx[j], com.N, com.dN(joker, j),
+          Zeeman::dsum(dnlte_source_dx[j], com.N, com.dN(j, joker),
                         pol, dpol_dtheta, dpol_deta,
                         X.dH_dv, X.dtheta_dv, X.deta_dv, false);
         } else if (deriv == Jacobian::Atm::MagneticW) {
-          Zeeman::dsum(dnlte_source_dx[j], com.N, com.dN(joker, j),
+          Zeeman::dsum(dnlte_source_dx[j], com.N, com.dN(j, joker),
                         pol, dpol_dtheta, dpol_deta,
                         X.dH_dw, X.dtheta_dw, X.deta_dw, false);
         } else {
-          Zeeman::sum(dnlte_source_dx[j], com.dN(joker, j), pol, false);
+          Zeeman::sum(dnlte_source_dx[j], com.dN(j, joker), pol, false);
         }
       }
     }